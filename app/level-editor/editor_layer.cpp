@@ -32,6 +32,7 @@
 
 #include "editor_layer.h"
 #include "editor_state.h"
+#include "panels/profiler_panel.h"
 #include "panels/scene_hierarchy_panel.h"
 #include "panels/statistic_panel.h"
 #include "panels/viewport_panel.h"
@@ -47,6 +48,7 @@ namespace {
 
 constexpr float ASPECT_RATION_DEFAULT{static_cast<float>(WindowProps::WIDTH_DEFAULT) /
                                       WindowProps::HEIGHT_DEFAULT};
+constexpr glm::vec4 CLEAR_COLOR{1.0f, 0.0f, 1.0f, 1.0f};
 
 } // namespace
 
@@ -83,7 +85,7 @@ void EditorLayer::onAttach()
 
     m_panels = {GE::makeShared<ViewportPanel>(m_editor_state),
                 GE::makeShared<SceneHierarchyPanel>(m_editor_state),
-                GE::makeShared<StatisticPanel>()};
+                GE::makeShared<StatisticPanel>(), GE::makeShared<ProfilerPanel>()};
 }
 
 void EditorLayer::onDetach()
@@ -98,6 +100,13 @@ void EditorLayer::onUpdate(GE::Timestamp delta_time)
 {
     GE_PROFILE_FUNC();
 
+    // The GUI isn't drawn while the render thread runs, so the scene is drawn to
+    // the window from the snapshot instead of the viewport framebuffer
+    if (!GE::RenderThread::isContextThread()) {
+        m_editor_state->scene()->onSimulate(delta_time);
+        return;
+    }
+
     updateViewport();
 
     if (m_editor_state->isVPFocused()) {
@@ -108,12 +117,20 @@ void EditorLayer::onUpdate(GE::Timestamp delta_time)
 
     m_editor_state->framebuffer()->bind();
 
-    GE::RenderCommand::clear({1.0f, 0.0f, 1.0f, 1.0f});
+    GE::RenderCommand::clear(CLEAR_COLOR);
     m_editor_state->scene()->onUpdate(delta_time);
 
     m_editor_state->framebuffer()->unbind();
 }
 
+void EditorLayer::onExtract(GE::RenderSnapshot* snapshot)
+{
+    GE_PROFILE_FUNC();
+
+    snapshot->setClearColor(CLEAR_COLOR);
+    m_editor_state->scene()->onExtract(snapshot);
+}
+
 void EditorLayer::onEvent(GE::Event* event)
 {
     GE_PROFILE_FUNC();
@@ -54,6 +54,7 @@ public:
     void onAttach() override;
     void onDetach() override;
     void onUpdate(GE::Timestamp delta_time) override;
+    void onExtract(GE::RenderSnapshot *snapshot) override;
     void onEvent(GE::Event *event) override;
     void onGuiRender() override;
 
@@ -50,16 +50,25 @@ Usage:
 Options:
     -h, --help                  Show this help.
     -p, --profile-file <path>   Enable profiling.
+    --capture-file <path>       Capture last frames when a frame exceeds the budget.
+    --capture-frames <count>    Number of captured frames [default: 300].
+    --frame-budget <ms>         Frame budget in milliseconds [default: 20].
     -c, --config-file <path>    Path to config file.
 )";
 
 const auto OPT_PROFILE_FILE = "--profile-file";
+const auto OPT_CAPTURE_FILE = "--capture-file";
+const auto OPT_CAPTURE_FRAMES = "--capture-frames";
+const auto OPT_FRAME_BUDGET = "--frame-budget";
 const auto OPT_CONFIG_FILE = "--config-file";
 
 const auto PROFILE_SESSION_NAME = "Level Editor Profiling";
 
 struct app_args_t {
     std::string profile_file;
+    std::string capture_file;
+    uint32_t capture_frames{};
+    GE::Timestamp frame_budget;
     std::string config_file;
 };
 
@@ -86,6 +95,9 @@ app_args_t parseArgs(int argc, char** argv)
 
     try {
         app_args.profile_file = getStringOptIfExist(args, OPT_PROFILE_FILE);
+        app_args.capture_file = getStringOptIfExist(args, OPT_CAPTURE_FILE);
+        app_args.capture_frames = args[OPT_CAPTURE_FRAMES].asLong();
+        app_args.frame_budget = args[OPT_FRAME_BUDGET].asLong() / GE_MS_IN_SEC;
         app_args.config_file = args[OPT_CONFIG_FILE].asString();
     } catch (const std::exception& e) {
         std::cout << "Failed to parse arguments: " << e.what() << std::endl;
@@ -104,6 +116,10 @@ int main(int argc, char** argv)
     if (!args.profile_file.empty()) {
         GE_PROFILE_ENABLE(true);
         GE_PROFILE_BEGIN_SESSION(PROFILE_SESSION_NAME, args.profile_file);
+    } else if (!args.capture_file.empty()) {
+        GE_PROFILE_ENABLE(true);
+        GE_PROFILE_BEGIN_CAPTURE(PROFILE_SESSION_NAME, args.capture_file,
+                                 args.capture_frames, args.frame_budget);
     }
 
     if (!GE::Manager::initialize(args.config_file)) {
@@ -0,0 +1,390 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "profiler_panel.h"
+
+#include "ge/core/frame_arena.h"
+#include "ge/debug/profile.h"
+
+#include <imgui.h>
+
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace {
+
+constexpr int PROFILER_PANEL_FRAMES_MIN{10};
+constexpr int PROFILER_PANEL_FRAMES_MAX{1000};
+constexpr float PROFILER_PANEL_GRAPH_HEIGHT{80.0f};
+constexpr float PROFILER_PANEL_LABEL_WIDTH_MIN{24.0f};
+constexpr double PROFILER_PANEL_STATS_PERIOD{0.5};
+
+using TraceEvent = GE::Debug::trace_event_t;
+
+double toMs(int64_t ns)
+{
+    return static_cast<double>(ns) / 1e6;
+}
+
+float toRatio(int64_t time, int64_t start, int64_t duration)
+{
+    float ratio = static_cast<float>(time - start) / static_cast<float>(duration);
+    return std::clamp(ratio, 0.0f, 1.0f);
+}
+
+// The color depends on the name only, so a scope is easy to follow between frames
+ImU32 getScopeColor(const char* name)
+{
+    auto hash = std::hash<std::string_view>{}(name);
+    float hue = static_cast<float>(hash % 360) / 360.0f;
+    return ImColor::HSV(hue, 0.5f, 0.7f);
+}
+
+std::string getThreadName(uint32_t tid)
+{
+    return tid == GE::Debug::TRACE_GPU_TID ? "GPU" : "Thread " + std::to_string(tid);
+}
+
+} // namespace
+
+namespace LE {
+
+void ProfilerPanel::onGuiRender()
+{
+    GE_PROFILE_FUNC();
+
+    if (ImGui::Begin("Profiler")) {
+#ifdef GE_PROFILING
+        drawControls();
+        updateFrames();
+        drawFrameGraph();
+        drawFlameChart();
+        drawScopeStats();
+#else
+        ImGui::Text("Profiling is disabled, build with GE_PROFILING");
+#endif
+    }
+
+    ImGui::End();
+}
+
+void ProfilerPanel::clear()
+{
+    GE_PROFILE_FUNC();
+
+#ifdef GE_PROFILING
+    if (m_recording) {
+        GE::Debug::Profiler::setLiveFramesCount(0);
+    }
+#endif
+
+    m_recording = false;
+    m_paused = false;
+    m_selected_frame = -1;
+    m_frames.clear();
+    m_frame_times.clear();
+    m_scope_stats.clear();
+}
+
+void ProfilerPanel::drawControls()
+{
+    bool recording_changed = ImGui::Checkbox("Record", &m_recording);
+    ImGui::SameLine();
+    ImGui::Checkbox("Pause", &m_paused);
+    ImGui::SameLine();
+    ImGui::PushItemWidth(ImGui::GetFontSize() * 10.0f);
+    ImGui::SliderInt("Frames", &m_frames_count, PROFILER_PANEL_FRAMES_MIN,
+                     PROFILER_PANEL_FRAMES_MAX);
+    ImGui::PopItemWidth();
+
+    // Changing the count restarts the collector, so it's applied once dragging ends
+    bool frames_count_changed = ImGui::IsItemDeactivatedAfterEdit() && m_recording;
+
+    if (!recording_changed && !frames_count_changed) {
+        return;
+    }
+
+#ifdef GE_PROFILING
+    if (m_recording) {
+        GE_PROFILE_ENABLE(true);
+    }
+
+    auto frames_count = static_cast<uint32_t>(m_recording ? m_frames_count : 0);
+    GE::Debug::Profiler::setLiveFramesCount(frames_count);
+#endif
+
+    m_paused = false;
+    m_selected_frame = -1;
+}
+
+void ProfilerPanel::drawFrameGraph()
+{
+    if (m_frame_times.empty()) {
+        ImGui::Text("No frames, enable recording");
+        return;
+    }
+
+    auto frames_count = static_cast<int>(m_frame_times.size());
+    float max_time = *std::max_element(m_frame_times.begin(), m_frame_times.end());
+    ImVec2 graph_size{ImGui::GetContentRegionAvail().x, PROFILER_PANEL_GRAPH_HEIGHT};
+
+    ImGui::PlotHistogram("##FrameTimes", m_frame_times.data(), frames_count, 0, nullptr,
+                         0.0f, max_time, graph_size);
+
+    const ImVec2& padding = ImGui::GetStyle().FramePadding;
+    ImVec2 graph_min{ImGui::GetItemRectMin().x + padding.x,
+                     ImGui::GetItemRectMin().y + padding.y};
+    ImVec2 graph_max{ImGui::GetItemRectMax().x - padding.x,
+                     ImGui::GetItemRectMax().y - padding.y};
+    float bar_width = (graph_max.x - graph_min.x) / static_cast<float>(frames_count);
+
+    if (ImGui::IsItemClicked()) {
+        auto frame_idx = static_cast<int>((ImGui::GetIO().MousePos.x - graph_min.x) /
+                                          bar_width);
+        m_selected_frame = std::clamp(frame_idx, 0, frames_count - 1);
+        m_paused = true;
+    }
+
+    if (m_selected_frame >= 0) {
+        float bar_x = graph_min.x + bar_width * static_cast<float>(m_selected_frame);
+        ImGui::GetWindowDrawList()->AddRectFilled({bar_x, graph_min.y},
+                                                  {bar_x + bar_width, graph_max.y},
+                                                  IM_COL32(255, 255, 255, 64));
+    }
+}
+
+void ProfilerPanel::drawFlameChart()
+{
+    if (m_frames.empty()) {
+        return;
+    }
+
+    int frame_idx = m_selected_frame >= 0 ? m_selected_frame
+                                          : static_cast<int>(m_frames.size()) - 1;
+    const auto& frame = m_frames[frame_idx];
+    int64_t frame_time = std::max<int64_t>(frame.end - frame.start, 1);
+
+    ImGui::Text("Frame %d: %.3f ms", frame_idx, toMs(frame_time));
+
+    GE::FrameVector<const TraceEvent*> events(frame.events.size());
+    std::transform(frame.events.begin(), frame.events.end(), events.begin(),
+                   [](const auto& event) { return &event; });
+
+    // Parents go before their children, so a scope's depth is the count of the
+    // scopes which haven't ended before it starts
+    std::sort(events.begin(), events.end(), [](const auto* lhs, const auto* rhs) {
+        if (lhs->tid != rhs->tid) {
+            return lhs->tid < rhs->tid;
+        }
+
+        return lhs->start != rhs->start ? lhs->start < rhs->start : lhs->end > rhs->end;
+    });
+
+    ImDrawList* draw_list = ImGui::GetWindowDrawList();
+    ImVec2 origin = ImGui::GetCursorScreenPos();
+    float width = ImGui::GetContentRegionAvail().x;
+    float row_height = ImGui::GetTextLineHeightWithSpacing();
+    bool is_hovered = ImGui::IsWindowHovered();
+    ImU32 text_color = ImGui::GetColorU32(ImGuiCol_Text);
+    float y = origin.y;
+    GE::FrameVector<int64_t> parent_ends;
+
+    for (size_t i{0}; i < events.size();) {
+        uint32_t tid = events[i]->tid;
+        size_t depth_max{0};
+
+        draw_list->AddText({origin.x, y}, text_color, getThreadName(tid).c_str());
+        y += row_height;
+        parent_ends.clear();
+
+        for (; i < events.size() && events[i]->tid == tid; i++) {
+            const auto& event = *events[i];
+
+            while (!parent_ends.empty() && parent_ends.back() <= event.start) {
+                parent_ends.pop_back();
+            }
+
+            auto depth = static_cast<float>(parent_ends.size());
+            parent_ends.push_back(event.end);
+            depth_max = std::max(depth_max, parent_ends.size());
+
+            float x0 = origin.x + width * toRatio(event.start, frame.start, frame_time);
+            float x1 = origin.x + width * toRatio(event.end, frame.start, frame_time);
+            ImVec2 rect_min{x0, y + depth * row_height};
+            ImVec2 rect_max{std::max(x1, x0 + 1.0f), rect_min.y + row_height - 1.0f};
+
+            draw_list->AddRectFilled(rect_min, rect_max, getScopeColor(event.name));
+
+            if (rect_max.x - rect_min.x > PROFILER_PANEL_LABEL_WIDTH_MIN) {
+                draw_list->PushClipRect(rect_min, rect_max, true);
+                draw_list->AddText(rect_min, text_color, event.name);
+                draw_list->PopClipRect();
+            }
+
+            if (is_hovered && ImGui::IsMouseHoveringRect(rect_min, rect_max)) {
+                ImGui::SetTooltip("%s: %.3f ms", event.name,
+                                  toMs(event.end - event.start));
+            }
+        }
+
+        y += static_cast<float>(depth_max) * row_height;
+    }
+
+    ImGui::Dummy({width, y - origin.y});
+}
+
+void ProfilerPanel::drawScopeStats()
+{
+    double now = ImGui::GetTime();
+
+    if (now - m_stats_update_time > PROFILER_PANEL_STATS_PERIOD) {
+        updateScopeStats();
+        m_stats_update_time = now;
+    }
+
+    if (!ImGui::CollapsingHeader("Scopes", ImGuiTreeNodeFlags_DefaultOpen)) {
+        return;
+    }
+
+    ImGui::Columns(5, "ScopeStats");
+    ImGui::Text("Scope");
+    ImGui::NextColumn();
+    ImGui::Text("Calls");
+    ImGui::NextColumn();
+    ImGui::Text("Min, ms");
+    ImGui::NextColumn();
+    ImGui::Text("Avg, ms");
+    ImGui::NextColumn();
+    ImGui::Text("P99, ms");
+    ImGui::NextColumn();
+    ImGui::Separator();
+
+    for (const auto& stats : m_scope_stats) {
+        ImGui::Text("%s", stats.name);
+        ImGui::NextColumn();
+        ImGui::Text("%u", stats.count);
+        ImGui::NextColumn();
+        ImGui::Text("%.3f", stats.min);
+        ImGui::NextColumn();
+        ImGui::Text("%.3f", stats.avg);
+        ImGui::NextColumn();
+        ImGui::Text("%.3f", stats.p99);
+        ImGui::NextColumn();
+    }
+
+    ImGui::Columns(1);
+}
+
+void ProfilerPanel::updateFrames()
+{
+    if (m_paused) {
+        return;
+    }
+
+#ifdef GE_PROFILING
+    GE::Debug::Profiler::readLiveFrames([this](const auto& frames) {
+        if (frames.empty()) {
+            m_frames.clear();
+            return;
+        }
+
+        while (!m_frames.empty() && m_frames.front().start < frames.front().start) {
+            m_frames.pop_front();
+        }
+
+        // The last copied frame is copied once again, it may have received late
+        // events of other threads
+        auto is_earlier = [](const auto& frame, int64_t start) {
+            return frame.start < start;
+        };
+        auto last_start = m_frames.empty() ? frames.front().start : m_frames.back().start;
+        auto first_copied =
+            std::lower_bound(frames.begin(), frames.end(), last_start, is_earlier);
+
+        if (!m_frames.empty()) {
+            m_frames.pop_back();
+        }
+
+        m_frames.insert(m_frames.end(), first_copied, frames.end());
+    });
+#endif
+
+    m_frame_times.clear();
+
+    for (const auto& frame : m_frames) {
+        m_frame_times.push_back(static_cast<float>(toMs(frame.end - frame.start)));
+    }
+
+    if (m_selected_frame >= static_cast<int>(m_frames.size())) {
+        m_selected_frame = -1;
+    }
+}
+
+void ProfilerPanel::updateScopeStats()
+{
+    GE_PROFILE_FUNC();
+
+    // Names are merged by value, the same scope may be recorded from different
+    // translation units
+    std::unordered_map<std::string_view, std::vector<int64_t>> scope_times;
+
+    for (const auto& frame : m_frames) {
+        for (const auto& event : frame.events) {
+            scope_times[event.name].push_back(event.end - event.start);
+        }
+    }
+
+    m_scope_stats.clear();
+
+    for (auto& [name, times] : scope_times) {
+        auto p99 = times.begin() + static_cast<ptrdiff_t>((times.size() - 1) * 99 / 100);
+        std::nth_element(times.begin(), p99, times.end());
+
+        scope_stats_t stats{};
+        stats.name = name.data();
+        stats.count = static_cast<uint32_t>(times.size());
+        stats.min = toMs(*std::min_element(times.begin(), times.end()));
+        stats.avg = toMs(std::accumulate(times.begin(), times.end(), int64_t{0})) /
+                    static_cast<double>(times.size());
+        stats.p99 = toMs(*p99);
+        m_scope_stats.push_back(stats);
+    }
+
+    // The slowest scopes go first
+    std::sort(m_scope_stats.begin(), m_scope_stats.end(),
+              [](const auto& lhs, const auto& rhs) { return lhs.p99 > rhs.p99; });
+}
+
+} // namespace LE
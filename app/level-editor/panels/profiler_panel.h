@@ -0,0 +1,83 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// NOLINTNEXTLINE(llvm-header-guard)
+#ifndef LE_PANELS_PROFILER_PANEL_H_
+#define LE_PANELS_PROFILER_PANEL_H_
+
+#include <ge/debug/trace_event.h>
+#include <panels/panel_base.h>
+
+#include <deque>
+#include <vector>
+
+namespace LE {
+
+// Shows the live frames of the profiler: frame time graph, flame chart of the
+// selected frame and statistics of scopes over the kept frames. Selecting a
+// frame pauses the update, so the frame doesn't slide away
+class GE_API ProfilerPanel: public PanelBase
+{
+public:
+    void onGuiRender() override;
+    void clear() override;
+
+private:
+    struct scope_stats_t {
+        const char* name{nullptr};
+        uint32_t count{};
+        double min{};
+        double avg{};
+        double p99{};
+    };
+
+    void drawControls();
+    void drawFrameGraph();
+    void drawFlameChart();
+    void drawScopeStats();
+
+    void updateFrames();
+    void updateScopeStats();
+
+    std::deque<GE::Debug::trace_frame_t> m_frames;
+    std::vector<float> m_frame_times;
+    std::vector<scope_stats_t> m_scope_stats;
+    int m_frames_count{300};
+    int m_selected_frame{-1};
+    bool m_recording{false};
+    bool m_paused{false};
+    double m_stats_update_time{0.0};
+};
+
+} // namespace LE
+
+#endif // LE_PANELS_PROFILER_PANEL_H_
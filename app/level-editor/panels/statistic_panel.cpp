@@ -32,6 +32,8 @@
 
 #include "statistic_panel.h"
 
+#include "ge/debug/counters.h"
+#include "ge/debug/memory.h"
 #include "ge/debug/profile.h"
 #include "ge/renderer/renderer_2d.h"
 
@@ -52,6 +54,32 @@ void StatisticPanel::onGuiRender()
         ImGui::Text("Quads: %u", stats.quad_count);
         ImGui::Text("Vertices: %u", stats.vertex_count);
         ImGui::Text("Indices: %u", stats.index_count);
+
+        ImGui::Separator();
+        ImGui::Text("Counters");
+        ImGui::Separator();
+
+        for (const auto& counter : GE::Debug::Counters::getFrameValues()) {
+            ImGui::Text("%s: %lld", counter.name, static_cast<long long>(counter.value));
+        }
+
+        ImGui::Separator();
+        ImGui::Text("Memory Budgets");
+        ImGui::Separator();
+
+        for (uint8_t i{0}; i < static_cast<uint8_t>(GE::Debug::MemoryTag::COUNT); i++) {
+            auto tag = static_cast<GE::Debug::MemoryTag>(i);
+            auto memory = GE::Debug::Memory::getStats(tag);
+
+            if (memory.budget == 0) {
+                continue;
+            }
+
+            ImGui::ProgressBar(static_cast<float>(memory.bytes) /
+                               static_cast<float>(memory.budget));
+            ImGui::SameLine();
+            ImGui::Text("%s", GE::Debug::toString(tag));
+        }
     }
 
     ImGui::End();
@@ -0,0 +1,82 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <ge/core/log.h>
+#include <ge/debug/trace_converter.h>
+
+#include <docopt.h>
+
+#include <iostream>
+
+namespace {
+
+constexpr auto USAGE = R"(Trace Converter
+
+Converts a binary profiler trace to the Chrome trace JSON which is loaded by
+chrome://tracing and Perfetto.
+
+Usage:
+    trace_converter <trace-file> <json-file>
+    trace_converter (-h | --help)
+
+Options:
+    -h, --help  Show this help.
+)";
+
+const auto ARG_TRACE_FILE = "<trace-file>";
+const auto ARG_JSON_FILE = "<json-file>";
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    docopt::Options args;
+
+    try {
+        args = docopt::docopt_parse(USAGE, {argv + 1, argv + argc}, true);
+    } catch (const docopt::DocoptExitHelp& e) {
+        std::cout << USAGE << std::endl;
+        return EXIT_SUCCESS;
+    } catch (const docopt::DocoptArgumentError& e) {
+        std::cout << USAGE << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (!GE::Log::initialize()) {
+        return EXIT_FAILURE;
+    }
+
+    bool converted = GE::Debug::convertTraceToJson(args[ARG_TRACE_FILE].asString(),
+                                                   args[ARG_JSON_FILE].asString());
+    GE::Log::shutdown();
+    return converted ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,111 @@
+#include "ge/core/log.h"
+#include "ge/debug/profile.h"
+#include "ge/thread_pool.h"
+
+#include "benchmark/benchmark.h"
+
+#include <atomic>
+#include <filesystem>
+
+namespace {
+
+namespace fs = std::filesystem;
+
+// Messages below the logger level are filtered out by spdlog
+void BM_LogFilteredLevel(benchmark::State& state)
+{
+    GE::Log::initialize();
+    GE::Log::core()->setLevel(GE_LOGLVL_ERR);
+
+    for (auto _ : state) {
+        GE_CORE_DBG("Filtered message: {} {}", state.iterations(), "text");
+    }
+
+    GE::Log::shutdown();
+}
+
+// Messages of a disabled category are filtered out before spdlog
+void BM_LogFilteredCategory(benchmark::State& state)
+{
+    GE::Log::initialize();
+    GE::Log::core()->setCategoryLevel(GE::LogCategory::RENDERER, GE_LOGLVL_NONE);
+
+    for (auto _ : state) {
+        GE_CORE_ERR_CAT(RENDERER, "Filtered message: {} {}", state.iterations(), "text");
+    }
+
+    GE::Log::core()->setCategoryLevel(GE::LogCategory::RENDERER, GE_LOGLVL_TRACE);
+    GE::Log::shutdown();
+}
+
+void BM_LogRateLimited(benchmark::State& state)
+{
+    GE::Log::initialize();
+    GE::Log::core()->setLevel(GE_LOGLVL_ERR);
+
+    for (auto _ : state) {
+        GE_CORE_DBG_PER_SEC(1, "Limited message: {}", state.iterations());
+    }
+
+    GE::Log::shutdown();
+}
+
+#if defined(GE_PROFILING)
+void BM_ProfileScopeDisabled(benchmark::State& state)
+{
+    GE_PROFILE_ENABLE(false);
+
+    for (auto _ : state) {
+        GE_PROFILE_SCOPE("Benchmark scope");
+    }
+
+    GE_PROFILE_ENABLE(true);
+}
+
+void BM_ProfileScopeRecording(benchmark::State& state)
+{
+    fs::path trace_file = fs::temp_directory_path() / "ge_bench_profile.json";
+    GE_PROFILE_BEGIN_SESSION("Benchmark", trace_file.string());
+
+    for (auto _ : state) {
+        GE_PROFILE_SCOPE("Benchmark scope");
+    }
+
+    GE_PROFILE_END_SESSION();
+    fs::remove(trace_file);
+}
+#endif // defined(GE_PROFILING)
+
+// Enqueueing a batch of small tasks and waiting for them
+void BM_ThreadPool(benchmark::State& state)
+{
+    constexpr int64_t tasks_count{1000};
+
+    GE::ThreadPool pool{"Benchmark"};
+    pool.start(state.range(0), false);
+    std::atomic<int64_t> executed{0};
+
+    for (auto _ : state) {
+        for (int64_t i{0}; i < tasks_count; i++) {
+            pool.enqueue(
+                [&executed] { executed.fetch_add(1, std::memory_order_relaxed); });
+        }
+
+        pool.wait();
+    }
+
+    pool.stop();
+    state.SetItemsProcessed(executed.load());
+}
+
+} // namespace
+
+BENCHMARK(BM_LogFilteredLevel);
+BENCHMARK(BM_LogFilteredCategory);
+BENCHMARK(BM_LogRateLimited);
+BENCHMARK(BM_ThreadPool)->Arg(1)->Arg(4)->UseRealTime();
+
+#if defined(GE_PROFILING)
+BENCHMARK(BM_ProfileScopeDisabled);
+BENCHMARK(BM_ProfileScopeRecording);
+#endif // defined(GE_PROFILING)
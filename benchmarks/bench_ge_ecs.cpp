@@ -0,0 +1,84 @@
+#include "ge/ecs/components.h"
+#include "ge/ecs/entity.h"
+#include "ge/ecs/entity_registry.h"
+
+#include "benchmark/benchmark.h"
+
+#include <vector>
+
+namespace {
+
+void BM_TransformComponent(benchmark::State& state)
+{
+    std::vector<GE::TransformComponent> transforms(1000);
+
+    for (size_t i{0}; i < transforms.size(); i++) {
+        auto value = static_cast<float>(i);
+        transforms[i].translation = {value, -value, 0.0f};
+        transforms[i].rotation = {0.0f, 0.0f, value * 0.01f};
+        transforms[i].scale = {1.0f + value * 0.1f, 1.0f, 1.0f};
+    }
+
+    for (auto _ : state) {
+        for (const auto& transform : transforms) {
+            benchmark::DoNotOptimize(transform.getTransform());
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * transforms.size());
+}
+
+void createEntities(GE::EntityRegistry* registry, size_t count)
+{
+    for (size_t i{0}; i < count; i++) {
+        auto entity = registry->create();
+
+        // Half of the entities are sprites
+        if (i % 2 == 0) {
+            entity.addComponent<GE::SpriteRendererComponent>();
+        }
+    }
+}
+
+void BM_EntityRegistryEach(benchmark::State& state)
+{
+    GE::EntityRegistry registry;
+    createEntities(&registry, state.range(0));
+
+    for (auto _ : state) {
+        float sum{0.0f};
+
+        registry.eachEntityWith<GE::TransformComponent>([&sum](GE::Entity entity) {
+            sum += entity.getComponent<GE::TransformComponent>().translation.x;
+        });
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_EntityRegistryEachGroup(benchmark::State& state)
+{
+    GE::EntityRegistry registry;
+    createEntities(&registry, state.range(0));
+
+    for (auto _ : state) {
+        float sum{0.0f};
+
+        registry.eachEntityWith<GE::SpriteRendererComponent, GE::TransformComponent>(
+            [&sum](GE::Entity entity) {
+                sum += entity.getComponent<GE::SpriteRendererComponent>().color.r;
+            });
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0) / 2);
+}
+
+} // namespace
+
+BENCHMARK(BM_TransformComponent);
+BENCHMARK(BM_EntityRegistryEach)->Arg(1000)->Arg(100000);
+BENCHMARK(BM_EntityRegistryEachGroup)->Arg(1000)->Arg(100000);
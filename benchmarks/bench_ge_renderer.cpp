@@ -0,0 +1,84 @@
+#include "bench_utils.h"
+
+#include "ge/renderer/orthographic_camera.h"
+#include "ge/renderer/renderer_2d.h"
+#include "ge/renderer/texture.h"
+
+#include "benchmark/benchmark.h"
+
+#include <vector>
+
+namespace {
+
+std::vector<GE::Renderer2D::quad_t> createQuads(size_t quads_count,
+                                                size_t textures_count)
+{
+    std::vector<GE::Shared<GE::Texture2D>> textures;
+
+    for (size_t i{0}; i < textures_count; i++) {
+        textures.push_back(GE::Texture2D::create(2, 2, 4));
+    }
+
+    std::vector<GE::Renderer2D::quad_t> quads(quads_count);
+
+    for (size_t i{0}; i < quads_count; i++) {
+        auto& quad = quads[i];
+        quad.pos = {static_cast<float>(i % 100) * 0.01f,
+                    static_cast<float>(i / 100) * 0.01f};
+        quad.rotation = static_cast<float>(i % 4) * 0.5f;
+
+        if (!textures.empty()) {
+            quad.texture = textures[i % textures.size()];
+        }
+    }
+
+    return quads;
+}
+
+void drawQuads(benchmark::State& state, size_t textures_count)
+{
+    GE::Bench::HeadlessRenderer renderer;
+
+    if (!renderer.isInitialized(&state)) {
+        return;
+    }
+
+    auto quads = createQuads(state.range(0), textures_count);
+    GE::OrthographicCamera camera{-1.0f, 1.0f, -1.0f, 1.0f};
+    GE::Bench::FrameRecorder recorder;
+
+    for (auto _ : state) {
+        recorder.beginFrame();
+        GE::Renderer2D::begin(camera);
+
+        for (const auto& quad : quads) {
+            GE::Renderer2D::draw(quad);
+        }
+
+        GE::Renderer2D::end();
+        recorder.endFrame();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    recorder.report(&state);
+}
+
+// Vertex generation of colored quads
+void BM_Renderer2DQuads(benchmark::State& state)
+{
+    drawQuads(state, 0);
+}
+
+// Looking up texture slots, more textures than slots cause extra batches
+void BM_Renderer2DTexturedQuads(benchmark::State& state)
+{
+    drawQuads(state, state.range(1));
+}
+
+} // namespace
+
+BENCHMARK(BM_Renderer2DQuads)->Arg(1000)->Arg(10000);
+BENCHMARK(BM_Renderer2DTexturedQuads)
+    ->Args({10000, 1})
+    ->Args({10000, 8})
+    ->Args({10000, 64});
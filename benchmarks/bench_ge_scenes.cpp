@@ -0,0 +1,85 @@
+#include "bench_utils.h"
+
+#include "ge/ecs/components.h"
+#include "ge/ecs/entity.h"
+#include "ge/ecs/scene.h"
+#include "ge/ecs/scriptable_entity.h"
+
+#include "benchmark/benchmark.h"
+
+namespace {
+
+constexpr double FRAME_TIME{1.0 / 60.0};
+
+class RotationScript: public GE::ScriptableEntity
+{
+public:
+    explicit RotationScript(const GE::Entity& entity)
+        : GE::ScriptableEntity{entity}
+    {}
+
+    void onCreate() override {}
+    void onDestroy() override {}
+
+    void onUpdate(GE::Timestamp dt) override
+    {
+        getComponent<GE::TransformComponent>().rotation.z += static_cast<float>(dt.sec());
+    }
+};
+
+void createSprites(GE::Scene* scene, int64_t count, bool with_scripts)
+{
+    for (int64_t i{0}; i < count; i++) {
+        auto entity = scene->createEntity();
+        auto& transform = entity.getComponent<GE::TransformComponent>();
+        transform.translation = {static_cast<float>(i % 100), static_cast<float>(i / 100),
+                                 0.0f};
+        entity.addComponent<GE::SpriteRendererComponent>();
+
+        if (with_scripts) {
+            entity.addComponent<GE::NativeScriptComponent>().bind<RotationScript>(entity);
+        }
+    }
+}
+
+void runScene(benchmark::State& state, bool with_scripts)
+{
+    GE::Bench::HeadlessRenderer renderer;
+
+    if (!renderer.isInitialized(&state)) {
+        return;
+    }
+
+    GE::Scene scene;
+    scene.setMainCamera(scene.createCamera());
+    scene.onViewportResize({1280.0f, 720.0f});
+    createSprites(&scene, state.range(0), with_scripts);
+
+    GE::Bench::FrameRecorder recorder;
+
+    for (auto _ : state) {
+        recorder.beginFrame();
+        scene.onUpdate(FRAME_TIME);
+        recorder.endFrame();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    recorder.report(&state);
+}
+
+// N sprite entities drawn through the main camera
+void BM_SceneSprites(benchmark::State& state)
+{
+    runScene(state, false);
+}
+
+// N sprite entities, every one is updated by a native script
+void BM_SceneScripts(benchmark::State& state)
+{
+    runScene(state, true);
+}
+
+} // namespace
+
+BENCHMARK(BM_SceneSprites)->Arg(1000)->Arg(10000);
+BENCHMARK(BM_SceneScripts)->Arg(1000)->Arg(10000);
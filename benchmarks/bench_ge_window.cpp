@@ -0,0 +1,130 @@
+#include "ge/window/event_channel.h"
+#include "ge/window/event_queue.h"
+#include "ge/window/input_snapshot.h"
+#include "ge/window/key_event.h"
+#include "ge/window/mouse_event.h"
+#include "ge/window/user_event.h"
+#include "ge/window/window_event.h"
+
+#include "benchmark/benchmark.h"
+
+namespace {
+
+bool onEvent(const GE::Event& event)
+{
+    benchmark::DoNotOptimize(&event);
+    return false;
+}
+
+// Dispatching like GUI does: one event is checked against every handled type
+void BM_EventDispatch(benchmark::State& state)
+{
+    GE::MouseMovedEvent event{1.0f, 2.0f};
+
+    for (auto _ : state) {
+        GE::EventDispatcher dispatcher{&event};
+        dispatcher.dispatch<GE::KeyPressedEvent>(onEvent);
+        dispatcher.dispatch<GE::KeyReleasedEvent>(onEvent);
+        dispatcher.dispatch<GE::KeyTypedEvent>(onEvent);
+        dispatcher.dispatch<GE::MouseScrolledEvent>(onEvent);
+        dispatcher.dispatch<GE::MouseButtonPressedEvent>(onEvent);
+        dispatcher.dispatch<GE::MouseButtonReleasedEvent>(onEvent);
+        dispatcher.dispatch<GE::WindowResizedEvent>(onEvent);
+        dispatcher.dispatch<GE::MouseMovedEvent>(onEvent);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+// The same handlers registered once in a table indexed by event type
+void BM_EventHandlerTable(benchmark::State& state)
+{
+    GE::MouseMovedEvent event{1.0f, 2.0f};
+    GE::EventHandlerTable<> handlers;
+    handlers.add<GE::KeyPressedEvent, onEvent>();
+    handlers.add<GE::KeyReleasedEvent, onEvent>();
+    handlers.add<GE::KeyTypedEvent, onEvent>();
+    handlers.add<GE::MouseScrolledEvent, onEvent>();
+    handlers.add<GE::MouseButtonPressedEvent, onEvent>();
+    handlers.add<GE::MouseButtonReleasedEvent, onEvent>();
+    handlers.add<GE::WindowResizedEvent, onEvent>();
+    handlers.add<GE::MouseMovedEvent, onEvent>();
+
+    for (auto _ : state) {
+        handlers.dispatch(&event);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+// A frame of raw mouse input: a burst of moves around a click, coalesced by the queue
+void BM_EventQueue(benchmark::State& state)
+{
+    auto moves = static_cast<int>(state.range(0));
+    GE::EventQueue queue;
+
+    for (auto _ : state) {
+        for (int i = 0; i < moves; i++) {
+            queue.push(GE::MouseMovedEvent{static_cast<float>(i), 0.0f});
+        }
+
+        queue.push(GE::MouseButtonPressedEvent{GE_BUTTON_LEFT});
+        queue.push(GE::MouseButtonReleasedEvent{GE_BUTTON_LEFT});
+
+        for (int i = 0; i < moves; i++) {
+            queue.push(GE::MouseMovedEvent{0.0f, static_cast<float>(i)});
+        }
+
+        queue.dispatch([](GE::Event* event) { onEvent(*event); });
+    }
+
+    state.SetItemsProcessed(state.iterations() * (2 * moves + 2));
+}
+
+// Events posted by workers, drained by the main thread once per frame
+void BM_EventChannel(benchmark::State& state)
+{
+    auto events_num = static_cast<uint32_t>(state.range(0));
+    GE::EventChannel channel{events_num};
+
+    for (auto _ : state) {
+        for (uint32_t i{0}; i < events_num; i++) {
+            channel.post<GE::UserEvent>(i);
+        }
+
+        channel.drain([](GE::Event* event) { onEvent(*event); });
+    }
+
+    state.SetItemsProcessed(state.iterations() * events_num);
+}
+
+// Scripts of many entities polling the same keys every frame
+void BM_InputSnapshotQuery(benchmark::State& state)
+{
+    constexpr GE::KeyCode keys[] = {GE_KEY_W, GE_KEY_A, GE_KEY_S, GE_KEY_D};
+    auto entities = static_cast<int>(state.range(0));
+    GE::InputSnapshot snapshot;
+    snapshot.setKeyPressed(GE_KEY_W, true);
+
+    for (auto _ : state) {
+        int pressed{0};
+
+        for (int i = 0; i < entities; i++) {
+            for (auto key : keys) {
+                pressed += snapshot.isKeyPressed(key) ? 1 : 0;
+            }
+        }
+
+        benchmark::DoNotOptimize(pressed);
+    }
+
+    state.SetItemsProcessed(state.iterations() * entities * std::size(keys));
+}
+
+} // namespace
+
+BENCHMARK(BM_EventDispatch);
+BENCHMARK(BM_EventHandlerTable);
+BENCHMARK(BM_EventQueue)->Arg(8)->Arg(64);
+BENCHMARK(BM_EventChannel)->Arg(64);
+BENCHMARK(BM_InputSnapshotQuery)->Arg(1000);
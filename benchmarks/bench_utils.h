@@ -0,0 +1,118 @@
+// NOLINTNEXTLINE
+#ifndef GE_BENCHMARKS_BENCH_UTILS_H_
+#define GE_BENCHMARKS_BENCH_UTILS_H_
+
+#include "ge/core/frame_arena.h"
+#include "ge/debug/memory.h"
+#include "ge/renderer/renderer.h"
+#include "ge/renderer/renderer_2d.h"
+#include "ge/renderer/shader.h"
+
+#include "benchmark/benchmark.h"
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+namespace GE::Bench {
+
+// Initializes the headless renderer with the stub texture shader
+class HeadlessRenderer
+{
+public:
+    HeadlessRenderer()
+        : m_assets_dir{std::filesystem::temp_directory_path() / "ge_bench_assets"}
+    {
+        auto shader_path = m_assets_dir / Paths::TEXTURE_SHADER;
+        std::filesystem::create_directories(shader_path.parent_path());
+        std::ofstream{shader_path.string() + GE_VERT_EXT} << "void main() {}";
+        std::ofstream{shader_path.string() + GE_FRAG_EXT} << "void main() {}";
+
+        m_initialized = Renderer::initialize(GE_HEADLESS_API) &&
+                        Renderer2D::initialize(m_assets_dir.string());
+    }
+
+    ~HeadlessRenderer()
+    {
+        Renderer2D::shutdown();
+        Renderer::shutdown();
+        std::filesystem::remove_all(m_assets_dir);
+    }
+
+    bool isInitialized(benchmark::State* state) const
+    {
+        if (!m_initialized) {
+            state->SkipWithError("Failed to initialize headless renderer");
+        }
+
+        return m_initialized;
+    }
+
+private:
+    std::filesystem::path m_assets_dir;
+    bool m_initialized{false};
+};
+
+// Measures iterations as frames of the main loop, the frame time percentiles,
+// draw calls and allocations per frame are reported as counters
+class FrameRecorder
+{
+public:
+    void beginFrame() { m_frame_begin = Clock::now(); }
+
+    void endFrame()
+    {
+        Microseconds frame_time{Clock::now() - m_frame_begin};
+        m_frame_times.push_back(frame_time.count());
+
+        m_draw_calls += Renderer2D::getStats().draw_calls_count;
+        Renderer2D::resetStats();
+
+        Debug::Memory::mergeFrame();
+
+        for (size_t tag{0}; tag < static_cast<size_t>(Debug::MemoryTag::COUNT); tag++) {
+            auto stats = Debug::Memory::getStats(static_cast<Debug::MemoryTag>(tag));
+            m_allocations += stats.frame_allocations;
+        }
+
+        FrameArena::nextFrame();
+    }
+
+    void report(benchmark::State* state)
+    {
+        if (m_frame_times.empty()) {
+            return;
+        }
+
+        auto frames_count = static_cast<double>(m_frame_times.size());
+        std::sort(m_frame_times.begin(), m_frame_times.end());
+
+        auto& counters = state->counters;
+        counters["frame_p50_us"] = getPercentile(0.50);
+        counters["frame_p95_us"] = getPercentile(0.95);
+        counters["frame_p99_us"] = getPercentile(0.99);
+        counters["draw_calls"] = static_cast<double>(m_draw_calls) / frames_count;
+        counters["allocations"] = static_cast<double>(m_allocations) / frames_count;
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+    using Microseconds = std::chrono::duration<double, std::micro>;
+
+    double getPercentile(double percentile) const
+    {
+        auto last_idx = static_cast<double>(m_frame_times.size() - 1);
+        return m_frame_times[static_cast<size_t>(percentile * last_idx)];
+    }
+
+    Clock::time_point m_frame_begin;
+    std::vector<double> m_frame_times;
+    uint64_t m_draw_calls{0};
+    uint64_t m_allocations{0};
+};
+
+} // namespace GE::Bench
+
+#endif // GE_BENCHMARKS_BENCH_UTILS_H_
@@ -41,6 +41,7 @@ namespace {
 
 constexpr float ASPECT_RATIO_DEFAULT{static_cast<float>(WindowProp::WIDTH_DEFAULT) /
                                      WindowProp::HEIGHT_DEFAULT};
+constexpr glm::vec4 CLEAR_COLOR{1.0f, 0.0f, 1.0f, 1.0f};
 
 } // namespace
 
@@ -57,7 +58,18 @@ void GuiLayer::onUpdate(Timestamp delta_time)
     GE_PROFILE_FUNC();
 
     m_camera_controller.onUpdate(delta_time);
-    RenderCommand::clear({1.0f, 0.0f, 1.0f, 1.0});
+
+    // The render thread clears the window with the extracted color
+    if (RenderThread::isContextThread()) {
+        RenderCommand::clear(CLEAR_COLOR);
+    }
+}
+
+void GuiLayer::onExtract(RenderSnapshot* snapshot)
+{
+    GE_PROFILE_FUNC();
+
+    snapshot->setClearColor(CLEAR_COLOR);
 }
 
 void GuiLayer::onEvent(Event* event)
@@ -46,6 +46,7 @@ public:
     explicit GuiLayer(bool show_gui_demo, const char* name = "Gui Layer");
 
     void onUpdate(Timestamp delta_time) override;
+    void onExtract(RenderSnapshot* snapshot) override;
     void onEvent(Event* event) override;
     void onGuiRender() override;
 
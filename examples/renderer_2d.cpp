@@ -47,6 +47,8 @@ constexpr float ZOOM_X0_75{0.75f};
 
 constexpr float ROTATION_90D_PER_1S{90.0f};
 
+constexpr glm::vec4 CLEAR_COLOR{1.0f, 0.0f, 1.0f, 1.0f};
+
 } // namespace
 
 namespace GE::Examples {
@@ -90,15 +92,19 @@ void Renderer2DLayer::onUpdate(Timestamp delta_time)
     {
         GE_PROFILE_SCOPE("Renderer2DLayer Prepare");
         m_camera_controller.onUpdate(delta_time);
-        RenderCommand::clear({1.0f, 0.0f, 1.0f, 1.0f});
-
         m_tex_blue_sqrs_quad.rotation +=
             static_cast<float>(delta_time.sec()) * ROTATION_90D_PER_1S;
-        Renderer2D::resetStats();
+    }
+
+    // The render thread draws the quads copied by onExtract()
+    if (!RenderThread::isContextThread()) {
+        return;
     }
 
     {
         GE_PROFILE_SCOPE("Renderer2DLayer Draw");
+        RenderCommand::clear(CLEAR_COLOR);
+        Renderer2D::resetStats();
 
         Begin<Renderer2D> begin{m_camera_controller.getCamera()};
         Renderer2D::draw(m_editable_quad);
@@ -108,6 +114,18 @@ void Renderer2DLayer::onUpdate(Timestamp delta_time)
     }
 }
 
+void Renderer2DLayer::onExtract(RenderSnapshot* snapshot)
+{
+    GE_PROFILE_FUNC();
+
+    snapshot->setClearColor(CLEAR_COLOR);
+    snapshot->beginView(m_camera_controller.getCamera());
+    snapshot->addSprite(m_editable_quad);
+    snapshot->addSprite(m_red_quad);
+    snapshot->addSprite(m_tex_blue_sqrs_quad);
+    snapshot->addSprite(m_tex_arrow_quad);
+}
+
 void Renderer2DLayer::onGuiRender()
 {
     GE_PROFILE_FUNC();
@@ -46,6 +46,7 @@ public:
     void onAttach() override;
     void onDetach() override;
     void onUpdate(Timestamp delta_time) override;
+    void onExtract(RenderSnapshot* snapshot) override;
     void onGuiRender() override;
 
 private:
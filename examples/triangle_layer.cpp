@@ -93,10 +93,12 @@ void TriangleLayer::onUpdate(Timestamp delta_time)
 {
     GE_PROFILE_FUNC();
 
-    {
-        GE_PROFILE_SCOPE("TriangleLayer Prepare");
-        m_camera_controller.onUpdate(delta_time);
-        RenderCommand::clear({1.0f, 0.0f, 1.0f, 1.0f});
+    GuiLayer::onUpdate(delta_time);
+
+    // Snapshots carry sprites only, so the triangle with its own shader is drawn
+    // by the sequential loop only
+    if (!RenderThread::isContextThread()) {
+        return;
     }
 
     {
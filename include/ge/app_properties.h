@@ -33,21 +33,40 @@
 #ifndef GE_APP_PROPERTIES_H_
 #define GE_APP_PROPERTIES_H_
 
+#include <ge/application.h>
+#include <ge/core/fixed_timestep.h>
+#include <ge/core/frame_pacer.h>
 #include <ge/core/log.h>
+#include <ge/debug/memory.h>
 #include <ge/renderer/renderer_api.h>
 #include <ge/window/window.h>
 
+#include <array>
+
 namespace GE {
 
 class GE_API AppProperties
 {
 public:
+    // Bytes per memory tag, 0 means no budget
+    using MemoryBudgets =
+        std::array<uint64_t, static_cast<size_t>(Debug::MemoryTag::COUNT)>;
+
     struct properties_t {
         RendererAPI::API api{GE_NONE_API};
         Logger::Level core_log_lvl{GE_LOGLVL_CRIT};
         Logger::Level client_log_lvl{GE_LOGLVL_CRIT};
         std::string assets_dir;
+        Log::properties_t log{};
         Window::properties_t window{};
+        bool pipelined_rendering{false};
+        FramePacer::properties_t frame_pacing{};
+        FixedTimestep::properties_t fixed_timestep{};
+        std::string record_input;
+        std::string replay_input;
+        bool headless{false};
+        Application::headless_properties_t headless_props{};
+        MemoryBudgets memory_budgets{};
     };
 
     static bool read(const std::string& filename, properties_t* props);
@@ -34,8 +34,14 @@
 #define GE_APPLICATION_H_
 
 #include "ge/core/timestamp.h"
+#include <ge/core/fixed_timestep.h>
+#include <ge/core/frame_pacer.h>
 #include <ge/core/non_copyable.h>
 #include <ge/layer_stack.h>
+#include <ge/renderer/render_thread.h>
+#include <ge/window/event_channel.h>
+#include <ge/window/event_queue.h>
+#include <ge/window/input_recording.h>
 #include <ge/window/window.h>
 
 #include <memory>
@@ -52,16 +58,83 @@ class WindowRestoredEvent;
 class GE_API Application
 {
 public:
+    struct headless_properties_t {
+        // A non-zero frame time is passed to layers instead of the measured one,
+        // so simulated time doesn't depend on how fast the frames are
+        double frame_time{FRAME_TIME_DEFAULT};
+        // The application is closed after the number of frames, zero runs until
+        // it's closed by a layer
+        uint64_t frames_count{FRAMES_COUNT_DEFAULT};
+
+        static constexpr double FRAME_TIME_DEFAULT{0.0};
+        static constexpr uint64_t FRAMES_COUNT_DEFAULT{0};
+    };
+
     static bool initialize(const Window::properties_t& window_props);
+    // Runs layers with a headless window and without the GUI. The render API must
+    // be a headless one, the software renderer draws offscreen
+    static bool initializeHeadless(const Window::properties_t& window_props,
+                                   const headless_properties_t& props);
     static void shutdown();
 
     static void run();
     static void close();
 
+    // Window events and frame times are written to the file
+    static bool recordInput(const std::string& filename);
+    // Recorded input is fed instead of the real one, the application is closed
+    // after the last recorded frame
+    static bool replayInput(const std::string& filename);
+
+    static const std::string& getRecordInputFile()
+    {
+        return get()->m_input_recorder.getFilename();
+    }
+
+    static const std::string& getReplayInputFile()
+    {
+        return get()->m_input_replay.getFilename();
+    }
+
+    static void setFixedTimestep(const FixedTimestep::properties_t& props)
+    {
+        get()->m_fixed_timestep = FixedTimestep{props};
+    }
+
+    static const FixedTimestep& getFixedTimestep() { return get()->m_fixed_timestep; }
+
+    static void setFramePacing(const FramePacer::properties_t& props)
+    {
+        get()->m_frame_pacer = FramePacer{props};
+    }
+    static const FramePacer& getFramePacer() { return get()->m_frame_pacer; }
+
+    // Fraction of a fixed step between the last simulated state and the frame
+    // time, rendering interpolates with it. It's 1.0 without the fixed timestep.
+    // The pipelined rendering gets it with the snapshot
+    static double getInterpolationAlpha() { return get()->m_fixed_timestep.getAlpha(); }
+
+    // Frames are rendered by a separate thread from the snapshots extracted by
+    // layers, while the next frame is simulated. Takes effect on run()
+    static void setPipelinedRendering(bool enabled)
+    {
+        get()->m_pipelined_rendering = enabled;
+    }
+    static bool isPipelinedRendering() { return get()->m_pipelined_rendering; }
+
     static void pushLayer(Shared<Layer> layer);
     static void pushOverlay(Shared<Layer> overlay);
 
     static const Window& getWindow() { return *get()->m_window; }
+    static bool isHeadless() { return get()->m_headless; }
+
+    // May be called from any thread, the event is dispatched on the main thread
+    // at the end of the current frame. Returns false if the channel is full
+    template<typename EventType, typename... Args>
+    static bool postEvent(Args&&... args)
+    {
+        return get()->m_event_channel.post<EventType>(std::forward<Args>(args)...);
+    }
 
 private:
     Application() = default;
@@ -81,9 +154,15 @@ private:
 
     void mainLoop();
 
+    void updateFixedLayers(Timestamp delta_time);
     void updateLayers(Timestamp delta_time);
+    void updateInput();
+    void submitFrame();
+    void dispatchEvents();
 
+    void onWindowEvent(Event* event);
     void onEvent(Event* event);
+    bool onWindowResized(const WindowResizedEvent& event);
     bool onWindowClosed(const WindowClosedEvent& event);
     bool onWindowMaximized(const WindowMaximizedEvent& event);
     bool onWindowMinimized(const WindowMinimizedEvent& event);
@@ -92,9 +171,19 @@ private:
     Scoped<Window> m_window;
     WindowState m_window_state{WindowState::NONE};
 
+    EventQueue m_event_queue;
+    EventChannel m_event_channel;
+    InputRecorder m_input_recorder;
+    InputReplay m_input_replay;
+    uint64_t m_reported_dropped_events{0};
     LayerStack m_layer_stack;
+    FixedTimestep m_fixed_timestep;
+    FramePacer m_frame_pacer;
+    RenderThread m_render_thread;
+    bool m_pipelined_rendering{false};
+    bool m_headless{false};
+    headless_properties_t m_headless_props;
     bool m_running{true};
-    Timestamp m_prev_frame_time;
 };
 
 } // namespace GE
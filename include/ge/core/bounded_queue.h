@@ -0,0 +1,155 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef GE_CORE_BOUNDED_QUEUE_H_
+#define GE_CORE_BOUNDED_QUEUE_H_
+
+#include <ge/core/core.h>
+#include <ge/core/non_copyable.h>
+#include <ge/core/utils.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace GE {
+
+// Lock-free queue with a fixed capacity, any thread may push and pop. Every
+// cell has a sequence number which tells whether it's free for the producer
+// of the position or is filled for the consumer of it. The capacity is
+// rounded up to a power of two
+template<typename T>
+class BoundedQueue: public NonCopyable
+{
+public:
+    explicit BoundedQueue(size_t capacity)
+        : m_capacity{roundCapacity(capacity)}
+        , m_mask{m_capacity - 1}
+        , m_cells{makeScoped<cell_t[]>(m_capacity)}
+    {
+        for (size_t i{0}; i < m_capacity; i++) {
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    bool tryPush(T&& value)
+    {
+        size_t pos = m_push_pos.load(std::memory_order_relaxed);
+        cell_t* cell{nullptr};
+
+        while (true) {
+            cell = &m_cells[pos & m_mask];
+            size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+
+            if (diff == 0) {
+                if (m_push_pos.compare_exchange_weak(pos, pos + 1,
+                                                     std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = m_push_pos.load(std::memory_order_relaxed);
+            }
+        }
+
+        cell->value = std::move(value);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool tryPop(T* value)
+    {
+        size_t pos = m_pop_pos.load(std::memory_order_relaxed);
+        cell_t* cell{nullptr};
+
+        while (true) {
+            cell = &m_cells[pos & m_mask];
+            size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+
+            if (diff == 0) {
+                if (m_pop_pos.compare_exchange_weak(pos, pos + 1,
+                                                    std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = m_pop_pos.load(std::memory_order_relaxed);
+            }
+        }
+
+        *value = std::move(cell->value);
+        cell->sequence.store(pos + m_capacity, std::memory_order_release);
+        return true;
+    }
+
+    // Approximate if the queue is being modified
+    bool isEmpty() const
+    {
+        return m_push_pos.load(std::memory_order_acquire) ==
+               m_pop_pos.load(std::memory_order_acquire);
+    }
+
+    size_t getCapacity() const { return m_capacity; }
+
+private:
+    struct cell_t {
+        std::atomic<size_t> sequence{0};
+        T value{};
+    };
+
+    static size_t roundCapacity(size_t capacity)
+    {
+        size_t rounded{2};
+
+        while (rounded < capacity) {
+            rounded *= 2;
+        }
+
+        return rounded;
+    }
+
+    static constexpr size_t CACHE_LINE_SIZE{64};
+
+    size_t m_capacity{};
+    size_t m_mask{};
+    Scoped<cell_t[]> m_cells;
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_push_pos{0};
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_pop_pos{0};
+};
+
+} // namespace GE
+
+#endif // GE_CORE_BOUNDED_QUEUE_H_
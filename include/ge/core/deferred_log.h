@@ -0,0 +1,207 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef GE_CORE_DEFERRED_LOG_H_
+#define GE_CORE_DEFERRED_LOG_H_
+
+#include <ge/core/core.h>
+
+#define SPDLOG_COMPILED_LIB 1
+#include <spdlog/common.h>
+#include <spdlog/fmt/fmt.h>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+namespace GE {
+
+class Logger;
+
+// Messages are captured as a decoder, a copy of the format string and the raw
+// bytes of the arguments into a queue of the logging thread. The format is
+// copied since a char array may go out of scope before the record is written.
+// The writer thread formats them and passes to the logger's sinks. Messages
+// with arguments other than arithmetic values and strings, or with too big
+// format and arguments are written directly, so they may be printed out of
+// order with the deferred ones.
+class GE_API DeferredLog
+{
+public:
+    using DecodeFunc = void (*)(const char* format, const uint8_t* args,
+                                spdlog::memory_buf_t* buffer);
+
+    static constexpr size_t DATA_SIZE_MAX{256};
+
+    struct record_t {
+        DecodeFunc decode{nullptr};
+        Logger* logger{nullptr};
+        spdlog::log_clock::time_point time;
+        spdlog::level::level_enum level{spdlog::level::off};
+        uint16_t format_size{};
+        // The format string followed by the arguments
+        uint8_t data[DATA_SIZE_MAX];
+
+        const char* getFormat() const { return reinterpret_cast<const char*>(data); }
+        const uint8_t* getArgs() const { return data + format_size; }
+    };
+
+    static bool initialize(size_t queue_size, bool drop_on_overflow);
+    static void shutdown();
+    static void flush();
+
+    static uint64_t getDroppedMessages();
+
+    template<size_t N, typename... Args>
+    static bool write(Logger* logger, spdlog::level::level_enum level,
+                      const char (&format)[N], const Args&... args)
+    {
+        if constexpr (!(isDeferrable<Args>() && ...)) {
+            return false;
+        } else {
+            if ((getArgSize(args) + ... + N) > DATA_SIZE_MAX) {
+                return false;
+            }
+
+            record_t record;
+            record.decode = &decode<Decoded<Args>...>;
+            record.logger = logger;
+            record.time = spdlog::log_clock::now();
+            record.level = level;
+            record.format_size = static_cast<uint16_t>(N);
+            std::memcpy(record.data, format, N);
+            record.data[N - 1] = '\0';
+
+            uint8_t* args_ptr = record.data + N;
+            (writeArg(args, &args_ptr), ...);
+            return push(record);
+        }
+    }
+
+    // The format string isn't a char array
+    template<typename Format, typename... Args>
+    static bool write(Logger* /*logger*/, spdlog::level::level_enum /*level*/,
+                      const Format& /*format*/, const Args&... /*args*/)
+    {
+        return false;
+    }
+
+private:
+    template<typename T>
+    static constexpr bool isString()
+    {
+        using Type = std::decay_t<T>;
+        return std::is_same_v<Type, const char*> || std::is_same_v<Type, char*> ||
+               std::is_same_v<Type, std::string> ||
+               std::is_same_v<Type, std::string_view>;
+    }
+
+    template<typename T>
+    static constexpr bool isDeferrable()
+    {
+        return std::is_arithmetic_v<T> || isString<T>();
+    }
+
+    template<typename T>
+    using Decoded = std::conditional_t<isString<T>(), std::string_view, T>;
+
+    template<typename T>
+    static size_t getArgSize(const T& arg)
+    {
+        if constexpr (isString<T>()) {
+            return sizeof(uint32_t) + std::string_view{arg}.size();
+        } else {
+            return sizeof(T);
+        }
+    }
+
+    template<typename T>
+    static void writeArg(const T& arg, uint8_t** args)
+    {
+        if constexpr (isString<T>()) {
+            std::string_view string{arg};
+            auto size = static_cast<uint32_t>(string.size());
+            std::memcpy(*args, &size, sizeof(size));
+            std::memcpy(*args + sizeof(size), string.data(), size);
+            *args += sizeof(size) + size;
+        } else {
+            std::memcpy(*args, &arg, sizeof(T));
+            *args += sizeof(T);
+        }
+    }
+
+    template<typename T>
+    static T readArg(const uint8_t** args)
+    {
+        if constexpr (std::is_same_v<T, std::string_view>) {
+            uint32_t size{};
+            std::memcpy(&size, *args, sizeof(size));
+            std::string_view string{reinterpret_cast<const char*>(*args + sizeof(size)),
+                                    size};
+            *args += sizeof(size) + size;
+            return string;
+        } else {
+            T value{};
+            std::memcpy(&value, *args, sizeof(T));
+            *args += sizeof(T);
+            return value;
+        }
+    }
+
+    template<typename... Args>
+    static void decode(const char* format, const uint8_t* args,
+                       spdlog::memory_buf_t* buffer)
+    {
+        // A single argument is the message itself, like in spdlog
+        if constexpr (sizeof...(Args) == 0) {
+            buffer->append(format, format + std::strlen(format));
+        } else {
+            // Elements of a braced list are initialized in order
+            std::tuple<Args...> values{readArg<Args>(&args)...};
+            std::apply(
+                [format, buffer](const auto&... values) {
+                    fmt::vformat_to(std::back_inserter(*buffer), format,
+                                    fmt::make_format_args(values...));
+                },
+                values);
+        }
+    }
+
+    static bool push(const record_t& record);
+};
+
+} // namespace GE
+
+#endif // GE_CORE_DEFERRED_LOG_H_
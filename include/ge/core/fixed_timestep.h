@@ -0,0 +1,102 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef GE_CORE_FIXED_TIMESTEP_H_
+#define GE_CORE_FIXED_TIMESTEP_H_
+
+#include <ge/core/core.h>
+#include <ge/core/timestamp.h>
+
+#include <cmath>
+#include <cstdint>
+
+namespace GE {
+
+// Splits frame time into simulation steps of a fixed length. The time which is
+// left is kept for the next frame, its fraction of a step is the alpha to
+// interpolate the rendered state with. The number of steps per frame is limited:
+// the time beyond the limit is dropped, so after a heavy frame the simulation
+// falls behind instead of spiraling into longer and longer catch-ups
+class GE_API FixedTimestep
+{
+public:
+    struct properties_t {
+        // A zero step disables the fixed timestep
+        double step{STEP_DEFAULT};
+        uint32_t max_steps{MAX_STEPS_DEFAULT};
+
+        static constexpr double STEP_DEFAULT{0.0};
+        static constexpr uint32_t MAX_STEPS_DEFAULT{5};
+    };
+
+    FixedTimestep() = default;
+
+    explicit FixedTimestep(const properties_t& props)
+        : m_props{props}
+    {}
+
+    uint32_t advance(Timestamp delta_time)
+    {
+        if (!isEnabled()) {
+            return 0;
+        }
+
+        m_accumulator += delta_time.sec();
+        auto steps = static_cast<uint64_t>(m_accumulator / m_props.step);
+
+        if (steps > m_props.max_steps) {
+            m_dropped_steps += steps - m_props.max_steps;
+            m_accumulator = std::fmod(m_accumulator, m_props.step);
+            return m_props.max_steps;
+        }
+
+        m_accumulator -= static_cast<double>(steps) * m_props.step;
+        return static_cast<uint32_t>(steps);
+    }
+
+    void reset() { m_accumulator = 0.0; }
+
+    bool isEnabled() const { return m_props.step > 0.0; }
+    Timestamp getStep() const { return m_props.step; }
+    double getAlpha() const { return isEnabled() ? m_accumulator / m_props.step : 1.0; }
+    uint64_t getDroppedSteps() const { return m_dropped_steps; }
+    const properties_t& getProperties() const { return m_props; }
+
+private:
+    properties_t m_props;
+    double m_accumulator{0.0};
+    uint64_t m_dropped_steps{0};
+};
+
+} // namespace GE
+
+#endif // GE_CORE_FIXED_TIMESTEP_H_
@@ -0,0 +1,144 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef GE_CORE_FRAME_ARENA_H_
+#define GE_CORE_FRAME_ARENA_H_
+
+#include <ge/core/core.h>
+#include <ge/core/non_copyable.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace GE {
+
+constexpr size_t ARENA_BLOCK_SIZE_DEFAULT{64 * 1024};
+
+// Bump allocator over a list of blocks. The memory is released all at once by
+// 'reset()' which keeps the blocks, so a steady workload doesn't allocate
+class GE_API LinearArena: public NonCopyable
+{
+public:
+    explicit LinearArena(size_t block_size = ARENA_BLOCK_SIZE_DEFAULT);
+    ~LinearArena() override;
+
+    void* allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+    void reset();
+
+    size_t getUsedSize() const;
+    size_t getCapacity() const;
+
+private:
+    struct block_t {
+        uint8_t* data{nullptr};
+        size_t size{};
+    };
+
+    bool allocateFromBlock(size_t size, size_t alignment, void** ptr);
+
+    std::vector<block_t> m_blocks;
+    size_t m_block_size{};
+    size_t m_block_idx{0};
+    size_t m_offset{0};
+    size_t m_used_size{0};
+};
+
+// Each thread has two arenas which are switched by 'nextFrame()'. The arena
+// of the frame is reset on the first use by the thread, so the transient data
+// is valid until the end of the next frame. The main loop starts a frame,
+// code which runs outside of it should call 'nextFrame()' itself
+class GE_API FrameArena
+{
+public:
+    static LinearArena* get();
+    static void nextFrame();
+    static uint64_t getFrameIdx();
+};
+
+// Allocates from an arena, the memory is never released by the container
+template<typename T>
+class ArenaAllocator
+{
+public:
+    using value_type = T;
+
+    template<typename U>
+    struct rebind {
+        using other = ArenaAllocator<U>;
+    };
+
+    ArenaAllocator()
+        : m_arena{FrameArena::get()}
+    {}
+
+    explicit ArenaAllocator(LinearArena* arena)
+        : m_arena{arena}
+    {}
+
+    // Containers convert allocators implicitly
+    template<typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) // NOLINT
+        : m_arena{other.getArena()}
+    {}
+
+    T* allocate(size_t count)
+    {
+        return static_cast<T*>(m_arena->allocate(count * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* /*ptr*/, size_t /*count*/) {}
+
+    LinearArena* getArena() const { return m_arena; }
+
+    template<typename U>
+    bool operator==(const ArenaAllocator<U>& other) const
+    {
+        return m_arena == other.getArena();
+    }
+
+    template<typename U>
+    bool operator!=(const ArenaAllocator<U>& other) const
+    {
+        return m_arena != other.getArena();
+    }
+
+private:
+    LinearArena* m_arena{nullptr};
+};
+
+template<typename T>
+using FrameVector = std::vector<T, ArenaAllocator<T>>;
+
+} // namespace GE
+
+#endif // GE_CORE_FRAME_ARENA_H_
@@ -0,0 +1,103 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef GE_CORE_FRAME_PACER_H_
+#define GE_CORE_FRAME_PACER_H_
+
+#include <ge/core/core.h>
+#include <ge/core/timestamp.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace GE {
+
+// Limits the frame rate without burning a core. The thread sleeps until shortly
+// before the deadline and spins the rest, since sleeping is only as precise as
+// the scheduler. The frame time may be averaged over several frames, so a single
+// hitch doesn't jerk the simulation
+class GE_API FramePacer
+{
+public:
+    struct properties_t {
+        // A zero frame rate doesn't limit frames
+        double target_fps{TARGET_FPS_DEFAULT};
+        // Time before the deadline which is spun instead of slept
+        double spin_time{SPIN_TIME_DEFAULT};
+        // Number of frames the frame time is averaged over, 1 disables smoothing
+        uint32_t smoothing_frames{SMOOTHING_FRAMES_DEFAULT};
+
+        static constexpr double TARGET_FPS_DEFAULT{0.0};
+        static constexpr double SPIN_TIME_DEFAULT{0.002};
+        static constexpr uint32_t SMOOTHING_FRAMES_DEFAULT{1};
+    };
+
+    struct statistics_t {
+        uint64_t frames_count{};
+        uint64_t missed_deadlines{};
+        Timestamp sleep_time;
+        Timestamp spin_time;
+    };
+
+    FramePacer() = default;
+    explicit FramePacer(const properties_t& props);
+
+    void reset(Timestamp now = Timestamp::now());
+
+    // Returns the smoothed time since the previous frame has begun
+    Timestamp beginFrame(Timestamp now = Timestamp::now());
+    // Waits for the deadline of the frame. A late frame isn't caught up with,
+    // the next deadline is counted from its end
+    void endFrame();
+
+    bool isLimited() const { return m_props.target_fps > 0.0; }
+    Timestamp getFramePeriod() const;
+    const statistics_t& getStats() const { return m_stats; }
+    const properties_t& getProperties() const { return m_props; }
+
+private:
+    void waitUntil(Timestamp deadline);
+
+    properties_t m_props;
+    statistics_t m_stats;
+
+    Timestamp m_frame_begin;
+    Timestamp m_deadline;
+
+    std::vector<double> m_frame_times;
+    size_t m_frame_time_idx{0};
+    double m_frame_times_sum{0.0};
+};
+
+} // namespace GE
+
+#endif // GE_CORE_FRAME_PACER_H_
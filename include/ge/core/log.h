@@ -34,12 +34,18 @@
 #define GE_CORE_LOG_H_
 
 #include <ge/core/core.h>
+#include <ge/core/deferred_log.h>
 
 #define SPDLOG_COMPILED_LIB 1
 #include <spdlog/fmt/ostr.h>
 #include <spdlog/spdlog.h>
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <limits>
 #include <memory>
+#include <vector>
 
 #define GE_COMPILED_LOGLVL_CRITICAL 1
 #define GE_COMPILED_LOGLVL_ERROR    2
@@ -55,49 +61,67 @@
 #if _GE_ACTIVE_LOGLVL >= GE_COMPILED_LOGLVL_CRITICAL
     #define GE_CORE_CRIT(...) ::GE::Log::core()->crit(__VA_ARGS__)
     #define GE_CRIT(...)      ::GE::Log::client()->crit(__VA_ARGS__)
+    #define GE_CORE_CRIT_CAT(category, ...) \
+        ::GE::Log::core()->crit(::GE::LogCategory::category, __VA_ARGS__)
 #else
     #define GE_CORE_CRIT(...) static_cast<void>(0)
     #define GE_CRIT(...)      static_cast<void>(0)
+    #define GE_CORE_CRIT_CAT(...) static_cast<void>(0)
 #endif
 
 #if _GE_ACTIVE_LOGLVL >= GE_COMPILED_LOGLVL_ERROR
     #define GE_CORE_ERR(...) ::GE::Log::core()->error(__VA_ARGS__)
     #define GE_ERR(...)      ::GE::Log::client()->error(__VA_ARGS__)
+    #define GE_CORE_ERR_CAT(category, ...) \
+        ::GE::Log::core()->error(::GE::LogCategory::category, __VA_ARGS__)
 #else
     #define GE_CORE_ERR(...) static_cast<void>(0)
     #define GE_ERR(...)      static_cast<void>(0)
+    #define GE_CORE_ERR_CAT(...) static_cast<void>(0)
 #endif
 
 #if _GE_ACTIVE_LOGLVL >= GE_COMPILED_LOGLVL_WARNING
     #define GE_CORE_WARN(...) ::GE::Log::core()->warn(__VA_ARGS__)
     #define GE_WARN(...)      ::GE::Log::client()->warn(__VA_ARGS__)
+    #define GE_CORE_WARN_CAT(category, ...) \
+        ::GE::Log::core()->warn(::GE::LogCategory::category, __VA_ARGS__)
 #else
     #define GE_CORE_WARN(...) static_cast<void>(0)
     #define GE_WARN(...)      static_cast<void>(0)
+    #define GE_CORE_WARN_CAT(...) static_cast<void>(0)
 #endif
 
 #if _GE_ACTIVE_LOGLVL >= GE_COMPILED_LOGLVL_INFO
     #define GE_CORE_INFO(...) ::GE::Log::core()->info(__VA_ARGS__)
     #define GE_INFO(...)      ::GE::Log::client()->info(__VA_ARGS__)
+    #define GE_CORE_INFO_CAT(category, ...) \
+        ::GE::Log::core()->info(::GE::LogCategory::category, __VA_ARGS__)
 #else
     #define GE_CORE_INFO(...) static_cast<void>(0)
     #define GE_INFO(...)      static_cast<void>(0)
+    #define GE_CORE_INFO_CAT(...) static_cast<void>(0)
 #endif
 
 #if _GE_ACTIVE_LOGLVL >= GE_COMPILED_LOGLVL_DEBUG
     #define GE_CORE_DBG(...) ::GE::Log::core()->debug(__VA_ARGS__)
     #define GE_DBG(...)      ::GE::Log::client()->debug(__VA_ARGS__)
+    #define GE_CORE_DBG_CAT(category, ...) \
+        ::GE::Log::core()->debug(::GE::LogCategory::category, __VA_ARGS__)
 #else
     #define GE_CORE_DBG(...) static_cast<void>(0)
     #define GE_DBG(...)      static_cast<void>(0)
+    #define GE_CORE_DBG_CAT(...) static_cast<void>(0)
 #endif
 
 #if _GE_ACTIVE_LOGLVL >= GE_COMPILED_LOGLVL_TRACE
     #define GE_CORE_TRACE(...) ::GE::Log::core()->trace(__VA_ARGS__)
     #define GE_TRACE(...)      ::GE::Log::client()->trace(__VA_ARGS__)
+    #define GE_CORE_TRACE_CAT(category, ...) \
+        ::GE::Log::core()->trace(::GE::LogCategory::category, __VA_ARGS__)
 #else
     #define GE_CORE_TRACE(...) static_cast<void>(0)
     #define GE_TRACE(...)      static_cast<void>(0)
+    #define GE_CORE_TRACE_CAT(...) static_cast<void>(0)
 #endif
 
 #define GE_LOGLVL_TRACE ::GE::Logger::Level::TRACE
@@ -108,8 +132,110 @@
 #define GE_LOGLVL_CRIT  ::GE::Logger::Level::CRITICAL
 #define GE_LOGLVL_NONE  ::GE::Logger::Level::NONE
 
+// Limiters are static, so calls from the same line share them. The first call
+// and every n-th one are logged
+#define GE_LOG_EVERY_N(n, log, ...)               \
+    do {                                          \
+        static ::GE::LogEveryN ge_log_limiter{n}; \
+        if (ge_log_limiter.isAllowed()) {         \
+            log(__VA_ARGS__);                     \
+        }                                         \
+    } while (false)
+
+// No more than n messages per second are logged
+#define GE_LOG_PER_SEC(n, log, ...)                    \
+    do {                                               \
+        static ::GE::LogRateLimiter ge_log_limiter{n}; \
+        if (ge_log_limiter.isAllowed()) {              \
+            log(__VA_ARGS__);                          \
+        }                                              \
+    } while (false)
+
+#define GE_CORE_ERR_EVERY_N(n, ...)   GE_LOG_EVERY_N(n, GE_CORE_ERR, __VA_ARGS__)
+#define GE_CORE_ERR_PER_SEC(n, ...)   GE_LOG_PER_SEC(n, GE_CORE_ERR, __VA_ARGS__)
+#define GE_ERR_EVERY_N(n, ...)        GE_LOG_EVERY_N(n, GE_ERR, __VA_ARGS__)
+#define GE_ERR_PER_SEC(n, ...)        GE_LOG_PER_SEC(n, GE_ERR, __VA_ARGS__)
+#define GE_CORE_WARN_EVERY_N(n, ...)  GE_LOG_EVERY_N(n, GE_CORE_WARN, __VA_ARGS__)
+#define GE_CORE_WARN_PER_SEC(n, ...)  GE_LOG_PER_SEC(n, GE_CORE_WARN, __VA_ARGS__)
+#define GE_WARN_EVERY_N(n, ...)       GE_LOG_EVERY_N(n, GE_WARN, __VA_ARGS__)
+#define GE_WARN_PER_SEC(n, ...)       GE_LOG_PER_SEC(n, GE_WARN, __VA_ARGS__)
+#define GE_CORE_INFO_EVERY_N(n, ...)  GE_LOG_EVERY_N(n, GE_CORE_INFO, __VA_ARGS__)
+#define GE_CORE_INFO_PER_SEC(n, ...)  GE_LOG_PER_SEC(n, GE_CORE_INFO, __VA_ARGS__)
+#define GE_INFO_EVERY_N(n, ...)       GE_LOG_EVERY_N(n, GE_INFO, __VA_ARGS__)
+#define GE_INFO_PER_SEC(n, ...)       GE_LOG_PER_SEC(n, GE_INFO, __VA_ARGS__)
+#define GE_CORE_DBG_EVERY_N(n, ...)   GE_LOG_EVERY_N(n, GE_CORE_DBG, __VA_ARGS__)
+#define GE_CORE_DBG_PER_SEC(n, ...)   GE_LOG_PER_SEC(n, GE_CORE_DBG, __VA_ARGS__)
+#define GE_DBG_EVERY_N(n, ...)        GE_LOG_EVERY_N(n, GE_DBG, __VA_ARGS__)
+#define GE_DBG_PER_SEC(n, ...)        GE_LOG_PER_SEC(n, GE_DBG, __VA_ARGS__)
+#define GE_CORE_TRACE_EVERY_N(n, ...) GE_LOG_EVERY_N(n, GE_CORE_TRACE, __VA_ARGS__)
+#define GE_CORE_TRACE_PER_SEC(n, ...) GE_LOG_PER_SEC(n, GE_CORE_TRACE, __VA_ARGS__)
+#define GE_TRACE_EVERY_N(n, ...)      GE_LOG_EVERY_N(n, GE_TRACE, __VA_ARGS__)
+#define GE_TRACE_PER_SEC(n, ...)      GE_LOG_PER_SEC(n, GE_TRACE, __VA_ARGS__)
+
 namespace GE {
 
+class AsyncSink;
+
+enum class LogCategory : uint8_t
+{
+    GENERAL = 0,
+    RENDERER,
+    ECS,
+    WINDOW,
+    GUI,
+    SCRIPT,
+    COUNT
+};
+
+class GE_API LogEveryN
+{
+public:
+    explicit LogEveryN(uint64_t n)
+        : m_n{n > 0 ? n : 1}
+    {}
+
+    bool isAllowed()
+    {
+        return m_calls.fetch_add(1, std::memory_order_relaxed) % m_n == 0;
+    }
+
+private:
+    uint64_t m_n{1};
+    std::atomic<uint64_t> m_calls{0};
+};
+
+class GE_API LogRateLimiter
+{
+public:
+    explicit LogRateLimiter(uint64_t count_per_sec)
+        : m_count_max{count_per_sec}
+    {}
+
+    bool isAllowed()
+    {
+        using namespace std::chrono;
+
+        int64_t now = duration_cast<nanoseconds>(steady_clock::now().time_since_epoch())
+                          .count();
+        int64_t period_begin = m_period_begin.load(std::memory_order_relaxed);
+
+        if (now - period_begin >= PERIOD_NS &&
+            m_period_begin.compare_exchange_strong(period_begin, now,
+                                                   std::memory_order_relaxed)) {
+            m_count.store(0, std::memory_order_relaxed);
+        }
+
+        return m_count.fetch_add(1, std::memory_order_relaxed) < m_count_max;
+    }
+
+private:
+    static constexpr int64_t PERIOD_NS{1'000'000'000};
+
+    uint64_t m_count_max{};
+    std::atomic<int64_t> m_period_begin{std::numeric_limits<int64_t>::min() / 2};
+    std::atomic<uint64_t> m_count{0};
+};
+
 class GE_API Logger
 {
 public:
@@ -124,69 +250,196 @@ public:
         NONE
     };
 
+    Logger();
     ~Logger();
 
-    bool initialize(const std::string& name);
+    bool initialize(const std::string& name, const std::vector<spdlog::sink_ptr>& sinks);
     void shutdown();
 
     void setLevel(Level level);
-    Level getLvel() const { return m_level; }
+    Level getLvel() const { return m_level.load(std::memory_order_relaxed); }
+
+    void setCategoryLevel(LogCategory category, Level level);
+    Level getCategoryLevel(LogCategory category) const
+    {
+        return m_category_levels[toIndex(category)].load(std::memory_order_relaxed);
+    }
+
+    // Is checked before the arguments are copied or formatted. Messages without
+    // a category belong to GENERAL
+    bool isEnabled(LogCategory category, Level level) const
+    {
+        Level category_level = getCategoryLevel(category);
+        return category_level != GE_LOGLVL_NONE && level <= category_level;
+    }
+
+    // Messages with literal format strings and plain arguments are formatted by
+    // the deferred log writer thread
+    void setDeferred(bool deferred)
+    {
+        m_deferred.store(deferred, std::memory_order_relaxed);
+    }
+    bool isDeferred() const { return m_deferred.load(std::memory_order_relaxed); }
+
+    void flush()
+    {
+        if (m_logger) {
+            m_logger->flush();
+        }
+    }
+
+    // The level has been checked when the message was deferred
+    void writeDeferred(spdlog::log_clock::time_point time,
+                       spdlog::level::level_enum level, spdlog::string_view_t message);
 
     template<typename... Args>
     void crit(const Args&... args)
     {
-        log(spdlog::level::critical, args...);
+        crit(LogCategory::GENERAL, args...);
+    }
+
+    template<typename... Args>
+    void crit(LogCategory category, const Args&... args)
+    {
+        if (isEnabled(category, GE_LOGLVL_CRIT)) {
+            log(spdlog::level::critical, args...);
+        }
     }
 
     template<typename... Args>
     void error(const Args&... args)
     {
-        log(spdlog::level::err, args...);
+        error(LogCategory::GENERAL, args...);
+    }
+
+    template<typename... Args>
+    void error(LogCategory category, const Args&... args)
+    {
+        if (isEnabled(category, GE_LOGLVL_ERR)) {
+            log(spdlog::level::err, args...);
+        }
     }
 
     template<typename... Args>
     void warn(const Args&... args)
     {
-        log(spdlog::level::warn, args...);
+        warn(LogCategory::GENERAL, args...);
+    }
+
+    template<typename... Args>
+    void warn(LogCategory category, const Args&... args)
+    {
+        if (isEnabled(category, GE_LOGLVL_WARN)) {
+            log(spdlog::level::warn, args...);
+        }
     }
 
     template<typename... Args>
     void info(const Args&... args)
     {
-        log(spdlog::level::info, args...);
+        info(LogCategory::GENERAL, args...);
+    }
+
+    template<typename... Args>
+    void info(LogCategory category, const Args&... args)
+    {
+        if (isEnabled(category, GE_LOGLVL_INFO)) {
+            log(spdlog::level::info, args...);
+        }
     }
 
     template<typename... Args>
     void debug(const Args&... args)
     {
-        log(spdlog::level::debug, args...);
+        debug(LogCategory::GENERAL, args...);
+    }
+
+    template<typename... Args>
+    void debug(LogCategory category, const Args&... args)
+    {
+        if (isEnabled(category, GE_LOGLVL_DBG)) {
+            log(spdlog::level::debug, args...);
+        }
     }
 
     template<typename... Args>
     void trace(const Args&... args)
     {
-        log(spdlog::level::trace, args...);
+        trace(LogCategory::GENERAL, args...);
+    }
+
+    template<typename... Args>
+    void trace(LogCategory category, const Args&... args)
+    {
+        if (isEnabled(category, GE_LOGLVL_TRACE)) {
+            log(spdlog::level::trace, args...);
+        }
     }
 
 private:
     template<typename... Args>
-    void log(const Args&... args)
+    void log(spdlog::level::level_enum level, const Args&... args)
     {
-        if (m_logger) {
-            m_logger->log(args...);
+        if (!m_logger || !m_logger->should_log(level)) {
+            return;
         }
+
+        if (isDeferred() && DeferredLog::write(this, level, args...)) {
+            return;
+        }
+
+        m_logger->log(level, args...);
+    }
+
+    static constexpr size_t toIndex(LogCategory category)
+    {
+        return static_cast<size_t>(category);
     }
 
     std::string m_logger_name;
-    Level m_level{GE_LOGLVL_INFO};
+    std::atomic<Level> m_level{GE_LOGLVL_INFO};
+    std::array<std::atomic<Level>, static_cast<size_t>(LogCategory::COUNT)>
+        m_category_levels;
+    std::atomic_bool m_deferred{false};
     std::shared_ptr<spdlog::logger> m_logger;
 };
 
 class GE_API Log
 {
 public:
+    enum class OverflowPolicy : uint8_t
+    {
+        BLOCK = 0,
+        DROP
+    };
+
+    struct properties_t {
+        bool async{ASYNC_DEFAULT};
+        uint32_t queue_size{QUEUE_SIZE_DEFAULT};
+        OverflowPolicy overflow_policy{OVERFLOW_POLICY_DEFAULT};
+        std::string file;
+        uint32_t file_size_max{FILE_SIZE_MAX_DEFAULT};
+        uint32_t files_count{FILES_COUNT_DEFAULT};
+        bool deferred{DEFERRED_DEFAULT};
+
+        static constexpr bool ASYNC_DEFAULT{false};
+        static constexpr uint32_t QUEUE_SIZE_DEFAULT{4096};
+        static constexpr OverflowPolicy OVERFLOW_POLICY_DEFAULT{OverflowPolicy::BLOCK};
+        static constexpr uint32_t FILE_SIZE_MAX_DEFAULT{10 * 1024 * 1024};
+        static constexpr uint32_t FILES_COUNT_DEFAULT{3};
+        static constexpr bool DEFERRED_DEFAULT{false};
+    };
+
     static bool initialize();
+    // Messages are written to the console and to the rotating 'file' if it's
+    // set. In the async mode they are written by a background thread. In the
+    // deferred mode arguments are copied as is and formatted by a background thread
+    static bool initialize(const properties_t& props);
     static void shutdown();
+    static void flush();
+
+    static const properties_t& getProperties() { return get()->m_props; }
+    static uint64_t getDroppedMessages();
 
     static Logger* core() { return &get()->m_core_logger; }
     static Logger* client() { return &get()->m_client_logger; }
@@ -202,11 +455,16 @@ private:
 
     Logger m_core_logger;
     Logger m_client_logger;
+    properties_t m_props{};
+    Shared<AsyncSink> m_async_sink;
 };
 
 std::string toString(Logger::Level level);
 Logger::Level toLogLvl(const std::string& level);
 
+std::string toString(Log::OverflowPolicy policy);
+Log::OverflowPolicy toOverflowPolicy(const std::string& policy);
+
 } // namespace GE
 
 #endif // GE_CORE_LOG_H_
@@ -0,0 +1,295 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef GE_CORE_POOL_H_
+#define GE_CORE_POOL_H_
+
+#include <ge/core/core.h>
+#include <ge/core/non_copyable.h>
+#include <ge/core/utils.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace GE {
+
+constexpr size_t POOL_CHUNK_SIZE_DEFAULT{64};
+
+// Generational index of a pool slot. The generation is bumped when the object
+// is destroyed, so a handle to it doesn't resolve after the slot is reused
+template<typename T>
+struct Handle {
+    static constexpr uint32_t INVALID_IDX{UINT32_MAX};
+
+    uint32_t index{INVALID_IDX};
+    uint32_t generation{0};
+
+    bool isValid() const { return index != INVALID_IDX; }
+
+    bool operator==(const Handle& other) const
+    {
+        return index == other.index && generation == other.generation;
+    }
+
+    bool operator!=(const Handle& other) const { return !(*this == other); }
+};
+
+// Objects are stored in chunks, so their addresses are stable and neighbours
+// are close in memory. Freed slots are reused first. The pool isn't
+// thread-safe, it's owned by the subsystem which creates the objects
+template<typename T, size_t ChunkSize = POOL_CHUNK_SIZE_DEFAULT>
+class Pool: public NonCopyable
+{
+public:
+    Pool() = default;
+
+    ~Pool() override
+    {
+        for (auto& chunk : m_chunks) {
+            for (size_t i{0}; i < ChunkSize; i++) {
+                if (chunk[i].is_alive) {
+                    chunk[i].object()->~T();
+                }
+            }
+        }
+    }
+
+    template<typename... Args>
+    Handle<T> create(Args&&... args)
+    {
+        if (m_free_idx == Handle<T>::INVALID_IDX) {
+            addChunk();
+        }
+
+        uint32_t index = m_free_idx;
+        slot_t* slot = getSlot(index);
+        new (slot->storage) T(std::forward<Args>(args)...);
+        m_free_idx = slot->next_free_idx;
+        slot->is_alive = true;
+        m_size++;
+
+        return {index, slot->generation};
+    }
+
+    void destroy(Handle<T> handle)
+    {
+        if (get(handle) == nullptr) {
+            return;
+        }
+
+        slot_t* slot = getSlot(handle.index);
+        slot->object()->~T();
+        slot->is_alive = false;
+        slot->generation++;
+        slot->next_free_idx = m_free_idx;
+        m_free_idx = handle.index;
+        m_size--;
+    }
+
+    T* get(Handle<T> handle) const
+    {
+        if (handle.index >= m_chunks.size() * ChunkSize) {
+            return nullptr;
+        }
+
+        slot_t* slot = getSlot(handle.index);
+        return slot->is_alive && slot->generation == handle.generation ? slot->object()
+                                                                       : nullptr;
+    }
+
+    // 'object' must be allocated by the pool
+    Handle<T> getHandle(const T* object) const
+    {
+        const auto* slot = reinterpret_cast<const slot_t*>(object);
+        return {slot->index, slot->generation};
+    }
+
+    size_t size() const { return m_size; }
+
+private:
+    struct slot_t {
+        alignas(T) unsigned char storage[sizeof(T)];
+        uint32_t index{};
+        uint32_t generation{0};
+        uint32_t next_free_idx{Handle<T>::INVALID_IDX};
+        bool is_alive{false};
+
+        T* object() { return std::launder(reinterpret_cast<T*>(storage)); }
+    };
+
+    slot_t* getSlot(uint32_t index) const
+    {
+        return &m_chunks[index / ChunkSize][index % ChunkSize];
+    }
+
+    void addChunk()
+    {
+        auto first_idx = static_cast<uint32_t>(m_chunks.size() * ChunkSize);
+        auto& chunk = m_chunks.emplace_back(makeScoped<slot_t[]>(ChunkSize));
+
+        for (size_t i{ChunkSize}; i > 0; i--) {
+            chunk[i - 1].index = first_idx + i - 1;
+            chunk[i - 1].next_free_idx = m_free_idx;
+            m_free_idx = first_idx + i - 1;
+        }
+    }
+
+    std::vector<Scoped<slot_t[]>> m_chunks;
+    uint32_t m_free_idx{Handle<T>::INVALID_IDX};
+    size_t m_size{0};
+};
+
+// Fixed size blocks carved from chunks. The storage is never destroyed, so
+// objects released by other static objects at exit are still returned to it
+template<size_t Size, size_t Alignment>
+class BlockStorage
+{
+public:
+    static BlockStorage* get()
+    {
+        static auto* instance = new BlockStorage;
+        return instance;
+    }
+
+    void* allocate()
+    {
+        std::lock_guard lock{m_mtx};
+
+        if (m_free_list == nullptr) {
+            addChunk();
+        }
+
+        block_t* block = m_free_list;
+        m_free_list = block->next;
+        return block;
+    }
+
+    void deallocate(void* ptr)
+    {
+        std::lock_guard lock{m_mtx};
+        auto* block = static_cast<block_t*>(ptr);
+        block->next = m_free_list;
+        m_free_list = block;
+    }
+
+private:
+    union alignas(Alignment) block_t {
+        block_t* next;
+        unsigned char storage[Size];
+    };
+
+    BlockStorage() = default;
+
+    void addChunk()
+    {
+        auto& chunk =
+            m_chunks.emplace_back(makeScoped<block_t[]>(POOL_CHUNK_SIZE_DEFAULT));
+
+        for (size_t i{0}; i < POOL_CHUNK_SIZE_DEFAULT; i++) {
+            chunk[i].next = m_free_list;
+            m_free_list = &chunk[i];
+        }
+    }
+
+    std::mutex m_mtx;
+    std::vector<Scoped<block_t[]>> m_chunks;
+    block_t* m_free_list{nullptr};
+};
+
+// Single objects of a type are allocated from the blocks of its size, arrays
+// fall back to the heap. 'std::allocate_shared()' rebinds it to the type of
+// the control block, so an object and its counters share one block
+template<typename T>
+class PoolAllocator
+{
+public:
+    using value_type = T;
+
+    template<typename U>
+    struct rebind {
+        using other = PoolAllocator<U>;
+    };
+
+    PoolAllocator() = default;
+
+    template<typename U>
+    PoolAllocator(const PoolAllocator<U>& /*other*/) // NOLINT
+    {}
+
+    T* allocate(size_t count)
+    {
+        if (count != 1) {
+            return std::allocator<T>{}.allocate(count);
+        }
+
+        return static_cast<T*>(Storage::get()->allocate());
+    }
+
+    void deallocate(T* ptr, size_t count)
+    {
+        if (count != 1) {
+            std::allocator<T>{}.deallocate(ptr, count);
+            return;
+        }
+
+        Storage::get()->deallocate(ptr);
+    }
+
+    template<typename U>
+    bool operator==(const PoolAllocator<U>& /*other*/) const
+    {
+        return true;
+    }
+
+    template<typename U>
+    bool operator!=(const PoolAllocator<U>& /*other*/) const
+    {
+        return false;
+    }
+
+private:
+    using Storage = BlockStorage<sizeof(T), alignof(T)>;
+};
+
+template<typename Type, typename... Args>
+inline Shared<Type> makePooled(Args&&... args)
+{
+    return std::allocate_shared<Type>(PoolAllocator<Type>{}, std::forward<Args>(args)...);
+}
+
+} // namespace GE
+
+#endif // GE_CORE_POOL_H_
@@ -0,0 +1,94 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef GE_DEBUG_COUNTERS_H_
+#define GE_DEBUG_COUNTERS_H_
+
+#include <ge/core/core.h>
+
+#include <string>
+#include <vector>
+
+#define GE_COUNTER_UPDATE(name, value, type, update)            \
+    do {                                                        \
+        static const ::GE::Debug::Counters::Id ge_counter_id =  \
+            ::GE::Debug::Counters::registerCounter(name, type); \
+        ::GE::Debug::Counters::update(ge_counter_id, value);    \
+    } while (false)
+
+#define GE_COUNTER(name, value) \
+    GE_COUNTER_UPDATE(name, value, ::GE::Debug::Counters::Type::COUNTER, add)
+#define GE_GAUGE(name, value) \
+    GE_COUNTER_UPDATE(name, value, ::GE::Debug::Counters::Type::GAUGE, set)
+
+namespace GE::Debug {
+
+// A counter is accumulated by every thread on its own and the values are summed
+// once per frame, a gauge keeps the last value set by any thread. Frame values
+// are sampled into the profiler trace as counter tracks while it's recording.
+// 'mergeFrame()' and the frame values are used from the main loop thread only.
+class GE_API Counters
+{
+public:
+    enum class Type : uint8_t
+    {
+        COUNTER = 0,
+        GAUGE
+    };
+
+    struct counter_t {
+        const char* name{nullptr};
+        Type type{Type::COUNTER};
+        // Counters have the sum of the last frame, gauges the last value
+        int64_t value{};
+        // Sum of all frames for counters, the last value for gauges
+        int64_t total{};
+    };
+
+    using Id = uint32_t;
+
+    static constexpr Id COUNTERS_MAX{256};
+    static constexpr Id INVALID_ID{COUNTERS_MAX};
+
+    // Counters with the same name share the id
+    static Id registerCounter(const std::string& name, Type type);
+
+    static void add(Id id, int64_t value);
+    static void set(Id id, int64_t value);
+
+    static void mergeFrame();
+    static const std::vector<counter_t>& getFrameValues();
+};
+
+} // namespace GE::Debug
+
+#endif // GE_DEBUG_COUNTERS_H_
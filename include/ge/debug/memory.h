@@ -0,0 +1,156 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef GE_DEBUG_MEMORY_H_
+#define GE_DEBUG_MEMORY_H_
+
+#include <ge/core/core.h>
+
+#include <cstddef>
+#include <cstdint>
+
+#ifdef GE_MEMORY_TRACKING
+    #define GE_MEMORY_TAG(tag) \
+        ::GE::Debug::MemoryTagScope GE_CONCAT(memory_tag, __LINE__)(tag)
+    #define GE_MEMORY_HOT_PATH(name) \
+        ::GE::Debug::MemoryHotPathScope GE_CONCAT(memory_hot_path, __LINE__)(name)
+#else
+    #define GE_MEMORY_TAG(tag)       static_cast<void>(tag)
+    #define GE_MEMORY_HOT_PATH(name) static_cast<void>(name)
+#endif
+
+namespace GE::Debug {
+
+enum class MemoryTag : uint8_t
+{
+    UNTAGGED = 0,
+    RENDERER,
+    TEXTURES,
+    ECS,
+    GUI,
+    EVENTS,
+    FRAME_ARENA,
+    COUNT
+};
+
+GE_API const char* toString(MemoryTag tag);
+
+// Bytes and allocations are tracked per tag. Allocations of the tagged
+// allocators are always tracked, the global operator new is hooked if the
+// engine is built with GE_MEMORY_TRACKING, then an allocation gets the tag of
+// the innermost 'GE_MEMORY_TAG()' scope of the thread. Allocations inside of
+// 'GE_MEMORY_HOT_PATH()' scopes are counted as churn and reported once per
+// scope. The frame values are published as counters by 'mergeFrame()'.
+class GE_API Memory
+{
+public:
+    struct stats_t {
+        uint64_t bytes{};
+        uint64_t allocations{};
+        uint64_t frame_allocations{};
+        uint64_t frame_bytes{};
+        uint64_t budget{};
+    };
+
+    static void* allocate(size_t size, MemoryTag tag);
+    static void deallocate(void* ptr);
+
+    // 0 means no budget. Exceeding the budget is reported once per excess
+    static void setBudget(MemoryTag tag, uint64_t bytes);
+    static stats_t getStats(MemoryTag tag);
+    static uint64_t getHotPathAllocations();
+
+    // Is called by the main loop at the end of every frame
+    static void mergeFrame();
+};
+
+class GE_API MemoryTagScope
+{
+public:
+    explicit MemoryTagScope(MemoryTag tag);
+    ~MemoryTagScope();
+
+private:
+    MemoryTag m_prev_tag{MemoryTag::UNTAGGED};
+};
+
+class GE_API MemoryHotPathScope
+{
+public:
+    explicit MemoryHotPathScope(const char* name);
+    ~MemoryHotPathScope();
+
+private:
+    const char* m_prev_name{nullptr};
+};
+
+// Tracks containers of a subsystem regardless of the global hooks
+template<typename T, MemoryTag Tag>
+class TaggedAllocator
+{
+public:
+    using value_type = T;
+
+    template<typename U>
+    struct rebind {
+        using other = TaggedAllocator<U, Tag>;
+    };
+
+    TaggedAllocator() = default;
+
+    template<typename U>
+    TaggedAllocator(const TaggedAllocator<U, Tag>& /*other*/) // NOLINT
+    {}
+
+    T* allocate(size_t count)
+    {
+        return static_cast<T*>(Memory::allocate(count * sizeof(T), Tag));
+    }
+
+    void deallocate(T* ptr, size_t /*count*/) { Memory::deallocate(ptr); }
+
+    template<typename U>
+    bool operator==(const TaggedAllocator<U, Tag>& /*other*/) const
+    {
+        return true;
+    }
+
+    template<typename U>
+    bool operator!=(const TaggedAllocator<U, Tag>& /*other*/) const
+    {
+        return false;
+    }
+};
+
+} // namespace GE::Debug
+
+#endif // GE_DEBUG_MEMORY_H_
@@ -37,151 +37,135 @@
     #include <ge/core/asserts.h>
     #include <ge/core/log.h>
     #include <ge/core/timestamp.h>
-    #include <ge/thread_pool.h>
+    #include <ge/debug/trace_event.h>
 
-    #include <fstream>
-    #include <iomanip>
-    #include <sstream>
+    #include <chrono>
+    #include <deque>
+    #include <functional>
+    #include <string>
+
+    #if defined(__x86_64__) || defined(__i386__)
+        #include <x86intrin.h>
+    #endif
 
     #define GE_PROFILE_ENABLE(enabled) ::GE::Debug::Profiler::enable(enabled)
     #define GE_PROFILE_BEGIN_SESSION(name, filepath) \
         ::GE::Debug::Profiler::begin(name, filepath)
+    #define GE_PROFILE_BEGIN_CAPTURE(name, filepath, frames_count, frame_budget) \
+        ::GE::Debug::Profiler::beginCapture(name, filepath, frames_count, frame_budget)
     #define GE_PROFILE_END_SESSION() ::GE::Debug::Profiler::end()
+    #define GE_PROFILE_FRAME_MARK()  ::GE::Debug::Profiler::markFrame()
     #define GE_PROFILE_SCOPE(name)   ::GE::Debug::Timer GE_CONCAT(timer, __LINE__)(name)
     #define GE_PROFILE_FUNC()        GE_PROFILE_SCOPE(GE_FUNC_NAME)
 
 namespace GE::Debug {
 
-constexpr auto PROFILER_THREAD_NAME = "Profiler";
-constexpr uint32_t PROFILER_THREAD_NUM{1};
-constexpr auto PROFILER_FILENAME_DEFAULT = "profile.json";
-
+constexpr auto PROFILER_FILENAME_DEFAULT = "profile.getrace";
+constexpr auto PROFILER_CAPTURE_FILENAME_DEFAULT = "capture.getrace";
+constexpr uint32_t PROFILER_CAPTURE_FRAMES_DEFAULT{300};
+constexpr double PROFILER_FRAME_BUDGET_DEFAULT{0.02};
+
+// Scopes are recorded into a lock-free ring of the calling thread, a collector
+// thread drains the rings in bulk and writes the trace. Events which don't fit
+// into a full ring are dropped and counted. A '.json' file gets the Chrome
+// trace format, any other one the compact binary format which is converted to
+// JSON by the 'trace_converter' tool.
+//
+// A capture session doesn't write everything, it keeps the last frames in
+// memory and dumps them when a frame exceeds the budget. A dump is written to
+// the capture file path with the index of the slow frame appended to the name,
+// e.g. 'capture_1234.getrace'.
+//
+// Live frames are kept in memory for the in-app viewers regardless of sessions,
+// recording is on while either of them is active.
 class GE_API Profiler
 {
 public:
-    struct session_t {
-        std::string name;
+    enum class Track : uint8_t
+    {
+        CPU = 0,
+        GPU,
+        FRAME,
+        COUNTER
     };
 
-    struct profile_result_t {
-        std::string name;
-        Timestamp start;
-        Timestamp elapsed_time;
-        std::thread::id thread_id;
+    // 'name' must outlive the session, scope names are string literals. Time of
+    // CPU events is in ticks of 'now()', time of GPU events is in nanoseconds
+    // of the steady clock. COUNTER events are samples, 'end' is the value
+    struct event_t {
+        const char* name{nullptr};
+        int64_t start{};
+        int64_t end{};
+        uint32_t thread_idx{};
+        Track track{Track::CPU};
     };
 
-    static void enable(bool enabled) { get()->m_enabled = enabled; }
-
-    static void begin(const std::string& name,
-                      const std::string& filepath = PROFILER_FILENAME_DEFAULT)
-    {
-        auto& profile_log = get()->m_profile_log;
-        auto& session = get()->m_session;
-
-        std::lock_guard lock{get()->m_session_mtx};
-        GE_CORE_ASSERT_MSG(!session, "Begin profiling '{}' when '{}' already open", name,
-                           session->name);
-
-        profile_log.open(filepath);
-
-        if (!profile_log) {
-            GE_CORE_ERR("Unable to open profiling log '{}'", filepath);
-            return;
-        }
-
-        session = std::make_unique<session_t>();
-        session->name = name;
-        get()->writeHeader();
-        get()->m_thread_pool.start(PROFILER_THREAD_NUM, true);
-    }
-
-    static void end() { get()->endSession(); }
-
-    static void enqueueData(profile_result_t result)
-    {
-        if (!get()->m_enabled) {
-            return;
-        }
-
-        get()->m_thread_pool.enqueue(&Profiler::writeProfile, get(), std::move(result));
-    }
-
-private:
-    Profiler() = default;
-    ~Profiler() { endSession(); }
-
-    static Profiler* get()
-    {
-        static Profiler instance;
-        return &instance;
-    }
+    using FrameReader = std::function<void(const std::deque<trace_frame_t>&)>;
 
-    void writeProfile(const profile_result_t& result)
-    {
-        m_profile_log << std::setprecision(3) << std::fixed << ",{"
-                      << R"("cat":"function",)"
-                      << R"("dur":)" << result.elapsed_time.us() << ","
-                      << R"("name":")" << result.name << "\","
-                      << R"("ph":"X",)"
-                      << R"("pid":0,)"
-                      << R"("tid":)" << result.thread_id << ","
-                      << R"("ts":)" << result.start.us() << "}" << std::endl;
-    }
+    static void enable(bool enabled);
+    static bool isEnabled();
+    static bool isRecording();
 
-    void writeHeader()
-    {
-        m_profile_log << R"({"otherData":{},"traceEvents":[{})" << std::endl;
-    }
-
-    void writeFooter() { m_profile_log << "]}" << std::endl; }
-
-    void endSession()
+    static void begin(const std::string& name,
+                      const std::string& filepath = PROFILER_FILENAME_DEFAULT);
+    static void
+    beginCapture(const std::string& name,
+                 const std::string& filepath = PROFILER_CAPTURE_FILENAME_DEFAULT,
+                 uint32_t frames_count = PROFILER_CAPTURE_FRAMES_DEFAULT,
+                 Timestamp frame_budget = PROFILER_FRAME_BUDGET_DEFAULT);
+    static void end();
+
+    // Is called by the main loop at the beginning of every frame
+    static void markFrame();
+
+    static void record(const char* name, int64_t start, int64_t end,
+                       Track track = Track::CPU);
+    static void recordCounter(const char* name, int64_t value);
+    static uint64_t getDroppedCount();
+
+    // Keeps the last 'frames_count' frames, 0 stops keeping them. The frames
+    // are behind the current one by the collector period
+    static void setLiveFramesCount(uint32_t frames_count);
+    // 'reader' is called under the lock of the live frames, so it mustn't keep
+    // a reference to them
+    static void readLiveFrames(const FrameReader& reader);
+
+    // Reading TSC is several times cheaper than the steady clock, ticks are
+    // converted to the steady clock time by the collector
+    static int64_t now()
     {
-        std::lock_guard lock{m_session_mtx};
-
-        if (!m_session) {
-            return;
-        }
-
-        m_thread_pool.stop();
-        writeFooter();
-        m_session.reset();
-        m_profile_log.close();
+    #if defined(__x86_64__) || defined(__i386__)
+        return static_cast<int64_t>(__rdtsc());
+    #else
+        auto now = std::chrono::steady_clock::now().time_since_epoch();
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+    #endif
     }
-
-    ThreadPool m_thread_pool{PROFILER_THREAD_NAME};
-    std::unique_ptr<session_t> m_session;
-    std::atomic_bool m_enabled{false};
-    std::ofstream m_profile_log;
-    std::mutex m_session_mtx;
 };
 
 class GE_API Timer
 {
 public:
     explicit Timer(const char* name)
-        : m_name{name}
-        , m_start_time{Timestamp::now()}
+        : m_name{Profiler::isRecording() ? name : nullptr}
+        , m_start{m_name != nullptr ? Profiler::now() : 0}
     {}
 
     ~Timer() { stop(); }
 
     void stop()
     {
-        if (m_stopped) {
+        if (m_name == nullptr) {
             return;
         }
 
-        Timestamp elapsed_time = Timestamp::now() - m_start_time;
-        auto thread_id = std::this_thread::get_id();
-        Profiler::enqueueData({m_name, m_start_time, elapsed_time, thread_id});
-        m_stopped = true;
+        Profiler::record(m_name, m_start, Profiler::now());
+        m_name = nullptr;
     }
 
 private:
     const char* m_name{nullptr};
-    Timestamp m_start_time;
-    bool m_stopped{false};
+    int64_t m_start{};
 };
 
 } // namespace GE::Debug
@@ -192,7 +176,15 @@ private:
             static_cast<void>(name);                 \
             static_cast<void>(filepath);             \
         } while (false)
+    #define GE_PROFILE_BEGIN_CAPTURE(name, filepath, frames_count, frame_budget) \
+        do {                                                                     \
+            static_cast<void>(name);                                             \
+            static_cast<void>(filepath);                                         \
+            static_cast<void>(frames_count);                                     \
+            static_cast<void>(frame_budget);                                     \
+        } while (false)
     #define GE_PROFILE_END_SESSION()
+    #define GE_PROFILE_FRAME_MARK()
     #define GE_PROFILE_SCOPE(name) static_cast<void>(name)
     #define GE_PROFILE_FUNC()
 #endif // GE_PROFILING
@@ -0,0 +1,69 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef GE_DEBUG_TRACE_EVENT_H_
+#define GE_DEBUG_TRACE_EVENT_H_
+
+#include <cstdint>
+#include <vector>
+
+namespace GE::Debug {
+
+// Events of all GPU timers share the track, threads are numbered from 1
+constexpr uint32_t TRACE_GPU_TID{0};
+
+// Time is in nanoseconds of the steady clock. Names are owned by the profiler
+// session or the trace reader
+struct trace_event_t {
+    const char* name{nullptr};
+    int64_t start{};
+    int64_t end{};
+    uint32_t tid{};
+};
+
+// A sample of a counter track, time is in nanoseconds of the steady clock
+struct trace_counter_t {
+    const char* name{nullptr};
+    int64_t time{};
+    int64_t value{};
+};
+
+// Events which have started within the frame
+struct trace_frame_t {
+    int64_t start{};
+    int64_t end{};
+    std::vector<trace_event_t> events;
+};
+
+} // namespace GE::Debug
+
+#endif // GE_DEBUG_TRACE_EVENT_H_
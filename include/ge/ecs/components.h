@@ -34,6 +34,7 @@
 #define GE_ECS_COMPONENTS_H_
 
 #include <ge/core/core.h>
+#include <ge/core/pool.h>
 #include <ge/core/utils.h>
 #include <ge/ecs/scene_camera.h>
 #include <ge/ecs/scriptable_entity.h>
@@ -42,6 +43,7 @@
 #include <glm/gtc/matrix_transform.hpp>
 
 #include <string>
+#include <utility>
 
 namespace GE {
 
@@ -65,7 +67,12 @@ struct GE_API NativeScriptComponent {
     NativeScriptComponent& operator=(NativeScriptComponent&& other) noexcept
     {
         if (this != &other) {
-            m_script = std::move(other.m_script);
+            if (isScriptBound()) {
+                destroy();
+            }
+
+            m_script = std::exchange(other.m_script, nullptr);
+            m_release = std::exchange(other.m_release, nullptr);
         }
 
         return *this;
@@ -82,7 +89,12 @@ struct GE_API NativeScriptComponent {
     void bind(Args&&... args)
     {
         GE_ASSERT_MSG(!m_script, "Scriptable Entity has already been bound!");
-        m_script = makeScoped<T>(std::forward<Args>(args)...);
+        auto* pool = getScriptPool<T>();
+        m_script = pool->get(pool->create(std::forward<Args>(args)...));
+        m_release = [](ScriptableEntity* script) {
+            auto* pool = getScriptPool<T>();
+            pool->destroy(pool->getHandle(static_cast<T*>(script)));
+        };
         m_script->onCreate();
     }
 
@@ -90,7 +102,7 @@ struct GE_API NativeScriptComponent {
     {
         GE_ASSERT_MSG(m_script, "Scriptable Entity hasn't been initialized!");
         m_script->onDestroy();
-        m_script.reset();
+        m_release(std::exchange(m_script, nullptr));
     }
 
     void onUpdate(Timestamp dt) { m_script->onUpdate(dt); }
@@ -98,7 +110,17 @@ struct GE_API NativeScriptComponent {
     bool isScriptBound() const { return m_script != nullptr; }
 
 private:
-    Scoped<ScriptableEntity> m_script;
+    // Scripts of a type share a pool, it isn't destroyed, since scenes may be
+    // destroyed with the static objects
+    template<typename T>
+    static Pool<T>* getScriptPool()
+    {
+        static auto* pool = new Pool<T>;
+        return pool;
+    }
+
+    ScriptableEntity* m_script{nullptr};
+    void (*m_release)(ScriptableEntity* script){nullptr};
 };
 
 struct GE_API SpriteRendererComponent {
@@ -44,6 +44,7 @@
 namespace GE {
 
 class Entity;
+class RenderSnapshot;
 
 class GE_API Scene
 {
@@ -51,6 +52,10 @@ public:
     using ForeachCallback = EntityRegistry::ForeachCallback;
 
     void onUpdate(Timestamp dt);
+    // onUpdate() split for the pipelined rendering: scripts are updated by the
+    // simulation, then sprites are copied to the snapshot instead of being drawn
+    void onSimulate(Timestamp dt);
+    void onExtract(RenderSnapshot* snapshot);
     void onViewportResize(const glm::vec2& viewport);
 
     void eachEntity(const ForeachCallback& callback);
@@ -60,10 +60,14 @@
 #include <ge/renderer/buffer_layout.h>
 #include <ge/renderer/buffers.h>
 #include <ge/renderer/framebuffer.h>
+#include <ge/renderer/gpu_profiler.h>
+#include <ge/renderer/gpu_timer.h>
 #include <ge/renderer/graphics_context.h>
 #include <ge/renderer/ortho_camera_controller.h>
 #include <ge/renderer/orthographic_camera.h>
 #include <ge/renderer/render_command.h>
+#include <ge/renderer/render_snapshot.h>
+#include <ge/renderer/render_thread.h>
 #include <ge/renderer/renderer.h>
 #include <ge/renderer/renderer_2d.h>
 #include <ge/renderer/renderer_api.h>
@@ -77,6 +81,7 @@
 #include <ge/window/key_event.h>
 #include <ge/window/mouse_button_codes.h>
 #include <ge/window/mouse_event.h>
+#include <ge/window/user_event.h>
 #include <ge/window/window.h>
 #include <ge/window/window_event.h>
 
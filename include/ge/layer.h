@@ -39,6 +39,7 @@
 namespace GE {
 
 class Event;
+class RenderSnapshot;
 
 class GE_API Layer: public Interface
 {
@@ -50,6 +51,11 @@ public:
     virtual void onAttach() = 0;
     virtual void onDetach() = 0;
     virtual void onUpdate(Timestamp delta_time) = 0;
+    // Is called with a constant step if the fixed timestep is enabled
+    virtual void onFixedUpdate([[maybe_unused]] Timestamp step) {}
+    // Is called after the update if the rendering is pipelined, the layer copies
+    // what it draws, since the snapshot is rendered during the next update
+    virtual void onExtract([[maybe_unused]] RenderSnapshot* snapshot) {}
     virtual void onEvent(Event* event) = 0;
     virtual void onGuiRender(){};
 
@@ -59,6 +59,8 @@ public:
     void pushOverlay(Shared<Layer> overlay);
     void popOverlay(const Shared<Layer>& overlay);
 
+    void clear();
+
     iterator begin() { return m_stack.begin(); }
     iterator end() { return m_stack.end(); }
     const_iterator begin() const { return m_stack.begin(); }
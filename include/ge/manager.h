@@ -33,6 +33,7 @@
 #ifndef GE_MANAGER_H_
 #define GE_MANAGER_H_
 
+#include <ge/application.h>
 #include <ge/core/core.h>
 
 #include <string>
@@ -59,6 +60,12 @@ private:
 
     bool m_initialized{false};
     std::string m_props_file;
+    // Files set by the config only, recordInput() and replayInput() called by
+    // the client are one-off and are not saved
+    std::string m_record_input;
+    std::string m_replay_input;
+    // Headless runs don't save the config, a windowed run keeps their properties
+    Application::headless_properties_t m_headless_props{};
 };
 
 } // namespace GE
@@ -51,8 +51,8 @@ public:
 
     virtual void setData(const void* data, uint32_t size) = 0;
 
-    static Scoped<VertexBuffer> create(const float* vertices, uint32_t size);
-    static Scoped<VertexBuffer> create(uint32_t size);
+    static Shared<VertexBuffer> create(const float* vertices, uint32_t size);
+    static Shared<VertexBuffer> create(uint32_t size);
 };
 
 class GE_API IndexBuffer: public NonCopyable
@@ -63,7 +63,7 @@ public:
 
     virtual uint32_t getCount() const = 0;
 
-    static Scoped<IndexBuffer> create(const uint32_t* indexes, uint32_t count);
+    static Shared<IndexBuffer> create(const uint32_t* indexes, uint32_t count);
 };
 
 } // namespace GE
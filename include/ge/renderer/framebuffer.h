@@ -37,6 +37,8 @@
 
 #include <glm/glm.hpp>
 
+#include <vector>
+
 namespace GE {
 
 class GE_API Framebuffer: public Interface
@@ -57,6 +59,9 @@ public:
     virtual uint32_t getColorAttachmentID() const = 0;
     virtual const properties_t& getProps() const = 0;
 
+    // RGBA8 pixels of the color attachment, rows are ordered from bottom to top
+    virtual std::vector<uint32_t> readColorAttachment() const = 0;
+
     static Scoped<GE::Framebuffer> create(const properties_t& props);
 };
 
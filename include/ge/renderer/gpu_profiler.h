@@ -0,0 +1,138 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef GE_RENDERER_GPU_PROFILER_H_
+#define GE_RENDERER_GPU_PROFILER_H_
+
+#ifdef GE_PROFILING
+    #include <ge/debug/profile.h>
+    #include <ge/renderer/gpu_timer.h>
+
+    #define GE_PROFILE_GPU_SCOPE(name) \
+        ::GE::GpuProfileScope GE_CONCAT(gpu_scope, __LINE__)(name)
+    #define GE_PROFILE_GPU_COLLECT()  ::GE::GpuProfiler::collect()
+    #define GE_PROFILE_GPU_SHUTDOWN() ::GE::GpuProfiler::shutdown()
+
+namespace GE {
+
+// Sends GPU timings to the profiler as events of the GPU track. Samples are
+// collected once per frame and are a few frames behind the CPU events.
+class GE_API GpuProfiler
+{
+public:
+    static bool begin(const char* name)
+    {
+        if (!Debug::Profiler::isRecording()) {
+            return false;
+        }
+
+        auto& timer = get()->m_timer;
+
+        if (timer == nullptr) {
+            timer = GpuTimer::create();
+        }
+
+        return timer->begin(name);
+    }
+
+    static void end() { get()->m_timer->end(); }
+
+    static void collect()
+    {
+        auto& timer = get()->m_timer;
+        auto& samples = get()->m_samples;
+
+        if (timer == nullptr) {
+            return;
+        }
+
+        timer->collect(&samples);
+
+        for (const auto& sample : samples) {
+            auto start = static_cast<int64_t>(sample.start.ns());
+            auto end = static_cast<int64_t>((sample.start + sample.elapsed_time).ns());
+            Debug::Profiler::record(sample.name, start, end, Debug::Profiler::Track::GPU);
+        }
+
+        samples.clear();
+    }
+
+    static void shutdown()
+    {
+        auto& timer = get()->m_timer;
+
+        if (timer != nullptr && timer->getDroppedCount() > 0) {
+            GE_CORE_WARN("GPU profiler has dropped {} scopes", timer->getDroppedCount());
+        }
+
+        timer.reset();
+    }
+
+private:
+    GpuProfiler() = default;
+
+    static GpuProfiler* get()
+    {
+        static GpuProfiler instance;
+        return &instance;
+    }
+
+    Scoped<GpuTimer> m_timer;
+    GpuTimer::Samples m_samples;
+};
+
+class GE_API GpuProfileScope
+{
+public:
+    explicit GpuProfileScope(const char* name)
+        : m_began{GpuProfiler::begin(name)}
+    {}
+
+    ~GpuProfileScope()
+    {
+        if (m_began) {
+            GpuProfiler::end();
+        }
+    }
+
+private:
+    bool m_began{false};
+};
+
+} // namespace GE
+#else
+    #define GE_PROFILE_GPU_SCOPE(name) static_cast<void>(name)
+    #define GE_PROFILE_GPU_COLLECT()
+    #define GE_PROFILE_GPU_SHUTDOWN()
+#endif // GE_PROFILING
+
+#endif // GE_RENDERER_GPU_PROFILER_H_
@@ -0,0 +1,69 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef GE_RENDERER_GPU_TIMER_H_
+#define GE_RENDERER_GPU_TIMER_H_
+
+#include <ge/core/non_copyable.h>
+#include <ge/core/timestamp.h>
+
+#include <vector>
+
+namespace GE {
+
+// Measures time spent by the GPU between begin() and end(). Scopes may be
+// nested, results become available a few frames later and are returned by
+// collect() without waiting for the GPU, the time is converted to the CPU
+// timeline of Timestamp::now().
+class GE_API GpuTimer: public NonCopyable
+{
+public:
+    struct sample_t {
+        const char* name{nullptr};
+        Timestamp start;
+        Timestamp elapsed_time;
+    };
+
+    using Samples = std::vector<sample_t>;
+
+    virtual bool begin(const char* name) = 0;
+    virtual void end() = 0;
+    virtual void collect(Samples* samples) = 0;
+
+    virtual uint64_t getDroppedCount() const = 0;
+
+    static Scoped<GpuTimer> create();
+};
+
+} // namespace GE
+
+#endif // GE_RENDERER_GPU_TIMER_H_
@@ -46,6 +46,10 @@ public:
     virtual void shutdown() = 0;
 
     virtual void swapBuffers() = 0;
+    // The context is current on one thread at a time, it must be released before
+    // another thread makes it current
+    virtual void makeCurrent() = 0;
+    virtual void releaseCurrent() = 0;
     virtual void* getNativeContext() const = 0;
 
     static Scoped<GraphicsContext> create(void* window);
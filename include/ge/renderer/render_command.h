@@ -56,6 +56,9 @@ public:
     static RendererAPI::API getAPI();
     static const RendererAPI::capabilities_t& getCapabilities();
 
+    static const RendererAPI::statistics_t& getStats();
+    static void resetStats();
+
 private:
     RenderCommand() = default;
 
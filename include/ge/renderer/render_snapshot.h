@@ -0,0 +1,107 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef GE_RENDERER_RENDER_SNAPSHOT_H_
+#define GE_RENDERER_RENDER_SNAPSHOT_H_
+
+#include <ge/core/core.h>
+#include <ge/renderer/renderer_2d.h>
+
+#include <glm/glm.hpp>
+
+#include <vector>
+
+namespace GE {
+
+class Entity;
+class OrthographicCamera;
+class Texture2D;
+
+// Copy of everything a frame draws. The simulation fills it, then it's rendered
+// while the next frame is simulated, so it doesn't refer to the scene state
+class GE_API RenderSnapshot
+{
+public:
+    struct sprite_t {
+        glm::mat4 transform{1.0f};
+        glm::vec4 color{1.0f};
+        Shared<Texture2D> texture;
+        float tiling_factor{1.0f};
+    };
+
+    struct view_t {
+        glm::mat4 vp_matrix{1.0f};
+        size_t sprites_begin{};
+        size_t sprites_end{};
+    };
+
+    void setViewport(uint32_t width, uint32_t height);
+    void setClearColor(const glm::vec4& color);
+    // Layers blend their last two fixed step states with it while extracting
+    void setInterpolationAlpha(double alpha) { m_interpolation_alpha = alpha; }
+
+    void beginView(const glm::mat4& vp_matrix);
+    void beginView(const OrthographicCamera& camera);
+    void beginView(const Entity& camera);
+
+    // Sprites are added to the last view
+    void addSprite(const Entity& entity);
+    void addSprite(const Renderer2D::quad_t& quad);
+    void addSprite(sprite_t sprite);
+
+    // Keeps the capacity, so a steady scene doesn't allocate
+    void clear();
+
+    uint32_t getViewportWidth() const { return m_viewport_width; }
+    uint32_t getViewportHeight() const { return m_viewport_height; }
+    bool hasClearColor() const { return m_has_clear_color; }
+    const glm::vec4& getClearColor() const { return m_clear_color; }
+    double getInterpolationAlpha() const { return m_interpolation_alpha; }
+
+    const std::vector<view_t>& getViews() const { return m_views; }
+    const std::vector<sprite_t>& getSprites() const { return m_sprites; }
+    bool isEmpty() const { return m_views.empty() && !m_has_clear_color; }
+
+private:
+    uint32_t m_viewport_width{0};
+    uint32_t m_viewport_height{0};
+    glm::vec4 m_clear_color{0.0f};
+    bool m_has_clear_color{false};
+    double m_interpolation_alpha{1.0};
+
+    std::vector<view_t> m_views;
+    std::vector<sprite_t> m_sprites;
+};
+
+} // namespace GE
+
+#endif // GE_RENDERER_RENDER_SNAPSHOT_H_
@@ -0,0 +1,101 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef GE_RENDERER_RENDER_THREAD_H_
+#define GE_RENDERER_RENDER_THREAD_H_
+
+#include <ge/core/asserts.h>
+#include <ge/core/non_copyable.h>
+#include <ge/renderer/render_snapshot.h>
+
+#include <array>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+// Commands of another thread would race with the render thread
+#define GE_ASSERT_CONTEXT_THREAD()                            \
+    GE_CORE_ASSERT_MSG(::GE::RenderThread::isContextThread(), \
+                       "Render context is used off the render thread")
+
+namespace GE {
+
+class Window;
+
+// Renders snapshots on a separate thread while the main thread simulates the
+// next frame. The graphics context of the window belongs to the render thread
+// until it's stopped, so the main thread must not issue render commands
+class GE_API RenderThread: public NonCopyable
+{
+public:
+    ~RenderThread() override;
+
+    bool start(Window* window);
+    void stop();
+
+    bool isRunning() const { return m_thread.joinable(); }
+
+    // Only the render thread may use the context while it's running, any thread
+    // otherwise
+    static bool isContextThread();
+    // Runs 'task' right away if the calling thread may use the context, or on
+    // the render thread before the next frame otherwise
+    static void runWithContext(std::function<void()> task);
+
+    // Only the main thread touches the snapshot until it's submitted
+    RenderSnapshot* getSnapshot() { return &m_snapshots[m_fill_idx]; }
+
+    // Waits for the previous frame, so the simulation is one frame ahead at most
+    void submit();
+    // Waits until the submitted frame has been presented
+    void wait();
+
+private:
+    void renderLoop();
+    void render(RenderSnapshot* snapshot);
+
+    Window* m_window{nullptr};
+    std::thread m_thread;
+    std::mutex m_mtx;
+    std::condition_variable m_cv;
+
+    std::array<RenderSnapshot, 2> m_snapshots;
+    size_t m_fill_idx{0};
+    size_t m_render_idx{0};
+    bool m_pending{false};
+    bool m_running{false};
+};
+
+} // namespace GE
+
+#endif // GE_RENDERER_RENDER_THREAD_H_
@@ -38,12 +38,13 @@
 
 #include <glm/glm.hpp>
 
-#include <map>
+#include <vector>
 
 namespace GE {
 
 class Entity;
 class OrthographicCamera;
+class RenderSnapshot;
 class Texture2D;
 class VertexArray;
 class VertexBuffer;
@@ -66,6 +67,8 @@ public:
         static constexpr float DEPTH_DEFAULT{0.0f};
         static constexpr float TILING_FACT_DEFAULT{1.0f};
         static constexpr float ROTATION_DEFAULT{0.0f};
+
+        glm::mat4 getTransform() const;
     };
 
     struct statistics_t {
@@ -88,6 +91,8 @@ public:
 
     static void draw(const Entity& entity);
     static void draw(const quad_t& quad);
+    // Draws every view of the snapshot with its own view-projection
+    static void draw(const RenderSnapshot& snapshot);
     static void flush();
 
     static const statistics_t& getStats();
@@ -97,7 +102,8 @@ private:
     struct draw_object_t {
         glm::mat4 transform{1.0f};
         glm::vec4 color{1.0f};
-        Shared<Texture2D> texture;
+        // Points to the caller's reference, so drawing doesn't touch the counter
+        const Shared<Texture2D>* texture{nullptr};
         float tiling_factor{1.0f};
     };
 
@@ -128,7 +134,7 @@ private:
     Shared<ShaderProgram> loadShader(const std::string& name,
                                      const std::string& shader_dir);
 
-    uint32_t getTexSlot(const Shared<Texture2D>& texture);
+    uint32_t getTexSlot(const Shared<Texture2D>* texture);
     void resetBatch();
 
     std::string m_assets_dir;
@@ -139,7 +145,7 @@ private:
     uint32_t m_index_count{};
     QuadVertexArray m_quad_vert_array;
     QVAIterator m_curr_vert_element;
-    std::map<uint32_t, Shared<Texture2D>> m_textures;
+    std::vector<Shared<Texture2D>> m_textures;
     uint32_t m_curr_free_tex_slot{};
 
     statistics_t m_stats{};
@@ -40,8 +40,10 @@
 #include <iostream>
 #include <memory>
 
-#define GE_NONE_API    ::GE::RendererAPI::API::NONE
-#define GE_OPEN_GL_API ::GE::RendererAPI::API::OPEN_GL
+#define GE_NONE_API     ::GE::RendererAPI::API::NONE
+#define GE_OPEN_GL_API  ::GE::RendererAPI::API::OPEN_GL
+#define GE_HEADLESS_API ::GE::RendererAPI::API::HEADLESS
+#define GE_SOFTWARE_API ::GE::RendererAPI::API::SOFTWARE
 
 namespace GE {
 
@@ -51,13 +53,21 @@ public:
     enum class API : uint8_t
     {
         NONE = 0,
-        OPEN_GL
+        OPEN_GL,
+        HEADLESS,
+        SOFTWARE
     };
 
     struct capabilities_t {
         uint32_t max_texture_slots{};
     };
 
+    struct statistics_t {
+        uint64_t draw_calls_count{};
+        uint64_t index_count{};
+        uint64_t clear_count{};
+    };
+
     explicit RendererAPI(API api)
         : m_api{api}
     {}
@@ -70,10 +80,15 @@ public:
     virtual const capabilities_t& getCapabilities() = 0;
     API getAPI() { return m_api; }
 
+    const statistics_t& getStats() const { return m_stats; }
+    void resetStats() { m_stats = {}; }
+
     static Scoped<RendererAPI> create(API api);
+    static bool isHeadless(API api);
 
 protected:
     Scoped<capabilities_t> m_capabilities;
+    statistics_t m_stats{};
     API m_api;
 };
 
@@ -55,8 +55,8 @@ public:
 class GE_API Texture2D: public Texture
 {
 public:
-    static Scoped<Texture2D> create(std::string path);
-    static Scoped<Texture2D> create(uint32_t width, uint32_t height, uint32_t bpp);
+    static Shared<Texture2D> create(std::string path);
+    static Shared<Texture2D> create(uint32_t width, uint32_t height, uint32_t bpp);
 };
 
 inline bool operator<(const Texture& lhs, const Texture& rhs)
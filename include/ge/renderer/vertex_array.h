@@ -53,7 +53,7 @@ public:
     virtual const Vertices& getVertexBuffers() const = 0;
     virtual Shared<IndexBuffer> getIndexBuffer() const = 0;
 
-    static Scoped<VertexArray> create();
+    static Shared<VertexArray> create();
 };
 
 } // namespace GE
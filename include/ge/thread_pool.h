@@ -34,6 +34,7 @@
 #define GE_THREAD_POOL_H_
 
 #include <ge/core/core.h>
+#include <ge/debug/memory.h>
 
 #include <functional>
 #include <future>
@@ -49,6 +50,7 @@ public:
 
     void start(uint32_t threads_num, bool wait_for_query_end);
     void stop();
+    void wait();
 
     template<typename Func, typename... Args>
     void enqueue(Func&& func, Args&&... args)
@@ -57,6 +59,9 @@ public:
             return;
         }
 
+        // std::function keeps only small callables inline, bigger ones and
+        // the queue nodes are reported as churn
+        GE_MEMORY_HOT_PATH("ThreadPool::enqueue");
         std::unique_lock lock{m_queue_mtx};
         m_queue.emplace(std::bind(std::forward<Func>(func), std::forward<Args>(args)...));
         lock.unlock();
@@ -71,9 +76,11 @@ private:
     std::atomic_bool m_terminated{true};
     bool m_wait_for_query_end{false};
     std::condition_variable m_condition;
+    std::condition_variable m_idle_condition;
     std::vector<std::thread> m_workers;
     const char* m_name{nullptr};
     std::queue<Task> m_queue;
+    uint32_t m_active_tasks{0};
     std::mutex m_queue_mtx;
 };
 
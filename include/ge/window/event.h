@@ -33,8 +33,10 @@
 #ifndef GE_WINDOW_EVENT_H_
 #define GE_WINDOW_EVENT_H_
 
+#include <array>
 #include <functional>
 #include <iostream>
+#include <type_traits>
 
 #include <ge/core/interface.h>
 
@@ -68,7 +70,11 @@ public:
         WINDOW_CLOSED,
         WINDOW_MAXIMIZED,
         WINDOW_MINIMIZED,
-        WINDOW_RESTORED
+        WINDOW_RESTORED,
+        // Application events
+        USER,
+
+        COUNT
     };
 
     virtual Type getType() const = 0;
@@ -105,6 +111,54 @@ private:
     Event* m_event{nullptr};
 };
 
+// Flat table with one handler per event type, so dispatching is a single indexed
+// lookup. Handlers are either free functions or methods of 'Owner'; the owner is
+// passed on dispatch, which allows to build the table once per class.
+template<typename Owner = void>
+class EventHandlerTable
+{
+public:
+    template<typename EventType, auto handler>
+    void add()
+    {
+        auto callback = []([[maybe_unused]] Owner* owner, const Event& event) {
+            const auto& typed_event = static_cast<const EventType&>(event);
+
+            if constexpr (std::is_member_function_pointer_v<decltype(handler)>) {
+                return (owner->*handler)(typed_event);
+            } else {
+                return handler(typed_event);
+            }
+        };
+
+        m_callbacks[toIndex(EventType::getStaticType())] = callback;
+    }
+
+    bool dispatch(Event* event, Owner* owner = nullptr) const
+    {
+        auto callback = m_callbacks[toIndex(event->getType())];
+
+        if (callback == nullptr) {
+            return false;
+        }
+
+        event->setHandled(callback(owner, *event));
+        return true;
+    }
+
+    bool has(Event::Type type) const { return m_callbacks[toIndex(type)] != nullptr; }
+
+private:
+    using callback_t = bool (*)(Owner*, const Event&);
+
+    static constexpr size_t toIndex(Event::Type type)
+    {
+        return static_cast<size_t>(type);
+    }
+
+    std::array<callback_t, static_cast<size_t>(Event::Type::COUNT)> m_callbacks{};
+};
+
 } // namespace GE
 
 inline std::ostream& operator<<(std::ostream& os, const ::GE::Event& event)
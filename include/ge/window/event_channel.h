@@ -0,0 +1,121 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef GE_WINDOW_EVENT_CHANNEL_H_
+#define GE_WINDOW_EVENT_CHANNEL_H_
+
+#include <ge/core/bounded_queue.h>
+#include <ge/window/event.h>
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+namespace GE {
+
+// Lets any thread post events which are drained by one consumer thread. Events
+// are constructed in a slab of fixed size slots allocated once; indices of free
+// and posted slots are passed through lock-free queues. Posting fails if all
+// slots are taken
+class GE_API EventChannel: public NonCopyable
+{
+public:
+    static constexpr size_t CAPACITY_DEFAULT{256};
+    static constexpr size_t SLOT_SIZE{64};
+    static constexpr size_t SLOT_ALIGNMENT{alignof(std::max_align_t)};
+
+    explicit EventChannel(size_t capacity = CAPACITY_DEFAULT);
+    ~EventChannel() override;
+
+    template<typename EventType, typename... Args>
+    bool post(Args&&... args)
+    {
+        static_assert(std::is_base_of_v<Event, EventType>, "Only events can be posted");
+        static_assert(sizeof(EventType) <= SLOT_SIZE, "Event doesn't fit into a slot");
+        static_assert(alignof(EventType) <= SLOT_ALIGNMENT, "Event is overaligned");
+
+        uint32_t index{};
+
+        if (!m_free_slots.tryPop(&index)) {
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        slot_t& slot = m_slots[index];
+        slot.event = new (slot.storage) EventType(std::forward<Args>(args)...);
+        m_posted_slots.tryPush(uint32_t{index});
+        return true;
+    }
+
+    // Events posted during the drain may be left for the next one
+    template<typename Callback>
+    size_t drain(Callback&& callback)
+    {
+        size_t drained{0};
+        uint32_t index{};
+
+        while (drained < m_capacity && m_posted_slots.tryPop(&index)) {
+            slot_t& slot = m_slots[index];
+            callback(slot.event);
+            slot.event->~Event();
+            slot.event = nullptr;
+            m_free_slots.tryPush(uint32_t{index});
+            drained++;
+        }
+
+        return drained;
+    }
+
+    size_t getCapacity() const { return m_capacity; }
+
+    uint64_t getDroppedEvents() const
+    {
+        return m_dropped.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct slot_t {
+        alignas(SLOT_ALIGNMENT) unsigned char storage[SLOT_SIZE];
+        Event* event{nullptr};
+    };
+
+    BoundedQueue<uint32_t> m_free_slots;
+    BoundedQueue<uint32_t> m_posted_slots;
+    size_t m_capacity{};
+    Scoped<slot_t[]> m_slots;
+    std::atomic<uint64_t> m_dropped{0};
+};
+
+} // namespace GE
+
+#endif // GE_WINDOW_EVENT_CHANNEL_H_
@@ -0,0 +1,96 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef GE_WINDOW_EVENT_QUEUE_H_
+#define GE_WINDOW_EVENT_QUEUE_H_
+
+#include <ge/window/key_event.h>
+#include <ge/window/mouse_event.h>
+#include <ge/window/user_event.h>
+#include <ge/window/window_event.h>
+
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace GE {
+
+// Collects events of a frame into a contiguous buffer and dispatches them in one
+// batch. Redundant events are coalesced with the previous queued one: mouse moves
+// and resizes keep the latest value, scroll offsets are summed.
+class GE_API EventQueue
+{
+public:
+    static constexpr size_t CAPACITY_DEFAULT{64};
+
+    explicit EventQueue(size_t capacity = CAPACITY_DEFAULT);
+
+    void push(const Event& event);
+
+    template<typename Callback>
+    void dispatch(Callback&& callback)
+    {
+        // Callbacks are allowed to push new events, they are dispatched next time
+        std::swap(m_events, m_dispatched);
+
+        for (auto& event : m_dispatched) {
+            std::visit([&callback](auto& typed_event) { callback(&typed_event); }, event);
+        }
+
+        m_dispatched.clear();
+    }
+
+    void clear() { m_events.clear(); }
+
+    size_t size() const { return m_events.size(); }
+    bool isEmpty() const { return m_events.empty(); }
+    uint64_t getCoalescedEvents() const { return m_coalesced; }
+
+private:
+    using event_t = std::variant<KeyPressedEvent, KeyReleasedEvent, KeyTypedEvent,
+                                 MouseMovedEvent, MouseScrolledEvent,
+                                 MouseButtonPressedEvent, MouseButtonReleasedEvent,
+                                 WindowResizedEvent, WindowClosedEvent,
+                                 WindowMaximizedEvent, WindowMinimizedEvent,
+                                 WindowRestoredEvent, UserEvent>;
+
+    template<typename EventType>
+    void pushEvent(const Event& event);
+
+    std::vector<event_t> m_events;
+    std::vector<event_t> m_dispatched;
+    uint64_t m_coalesced{0};
+};
+
+} // namespace GE
+
+#endif // GE_WINDOW_EVENT_QUEUE_H_
@@ -34,6 +34,7 @@
 #define GE_WINDOW_INPUT_H_
 
 #include <ge/core/interface.h>
+#include <ge/window/input_snapshot.h>
 #include <ge/window/key_codes.h>
 #include <ge/window/mouse_button_codes.h>
 
@@ -45,6 +46,8 @@
 
 namespace GE {
 
+class Event;
+
 class InputImpl: public Interface
 {
 public:
@@ -53,12 +56,11 @@ public:
 
     virtual int32_t toNativeKeyCode(KeyCode key_code) const = 0;
     virtual KeyCode toGEKeyCode(int32_t key_code) const = 0;
-    virtual bool isKeyPressed(KeyCode key_code) const = 0;
 
     virtual uint8_t toNativeButton(MouseButton button) const = 0;
     virtual MouseButton toGEMouseButton(uint8_t button) const = 0;
-    virtual bool isMouseButtonPressed(MouseButton button) const = 0;
-    virtual glm::vec2 getMousePos() const = 0;
+
+    virtual void updateSnapshot(InputSnapshot* snapshot) const = 0;
 };
 
 class GE_API Input
@@ -67,6 +69,13 @@ public:
     static bool initialize();
     static void shutdown();
 
+    // Captures the input state, is called once per frame after polling events
+    static void update();
+
+    // Replayed input replaces the devices: the state is built from the events
+    static void beginReplayFrame();
+    static void replayEvent(const Event& event);
+
     static int32_t toNativeKeyCode(KeyCode key_code)
     {
         return get()->m_pimpl->toNativeKeyCode(key_code);
@@ -79,7 +88,17 @@ public:
 
     static bool isKeyPressed(KeyCode key_code)
     {
-        return get()->m_pimpl->isKeyPressed(key_code);
+        return get()->m_snapshot.isKeyPressed(key_code);
+    }
+
+    static bool isKeyJustPressed(KeyCode key_code)
+    {
+        return get()->m_snapshot.isKeyJustPressed(key_code);
+    }
+
+    static bool isKeyJustReleased(KeyCode key_code)
+    {
+        return get()->m_snapshot.isKeyJustReleased(key_code);
     }
 
     static uint8_t toNativeButton(MouseButton button)
@@ -94,10 +113,22 @@ public:
 
     static bool isMouseButtonPressed(MouseButton button)
     {
-        return get()->m_pimpl->isMouseButtonPressed(button);
+        return get()->m_snapshot.isMouseButtonPressed(button);
+    }
+
+    static bool isMouseButtonJustPressed(MouseButton button)
+    {
+        return get()->m_snapshot.isMouseButtonJustPressed(button);
     }
 
-    static glm::vec2 getMousePos() { return get()->m_pimpl->getMousePos(); }
+    static bool isMouseButtonJustReleased(MouseButton button)
+    {
+        return get()->m_snapshot.isMouseButtonJustReleased(button);
+    }
+
+    static glm::vec2 getMousePos() { return get()->m_snapshot.getMousePos(); }
+
+    static const InputSnapshot& getSnapshot() { return get()->m_snapshot; }
 
 private:
     Input() = default;
@@ -109,6 +140,7 @@ private:
     }
 
     Scoped<InputImpl> m_pimpl;
+    InputSnapshot m_snapshot;
 };
 
 } // namespace GE
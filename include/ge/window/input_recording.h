@@ -0,0 +1,100 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef GE_WINDOW_INPUT_RECORDING_H_
+#define GE_WINDOW_INPUT_RECORDING_H_
+
+#include <ge/core/non_copyable.h>
+#include <ge/core/timestamp.h>
+
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace GE {
+
+class Event;
+
+// Input is recorded as a binary stream of frames: the delta time of a frame
+// followed by the window events which have been received during it
+
+class GE_API InputRecorder: public NonCopyable
+{
+public:
+    bool open(const std::string& filename);
+    void close();
+
+    void beginFrame(Timestamp delta_time);
+    void record(const Event& event);
+
+    bool isOpen() const { return m_file.is_open(); }
+    const std::string& getFilename() const { return m_filename; }
+
+private:
+    template<typename T>
+    void write(const T& value);
+
+    std::ofstream m_file;
+    std::string m_filename;
+};
+
+class GE_API InputReplay: public NonCopyable
+{
+public:
+    using EventCallback = std::function<void(const Event&)>;
+
+    bool open(const std::string& filename);
+    void close();
+
+    // Returns false if there are no frames left
+    bool nextFrame(Timestamp* delta_time);
+    void readEvents(const EventCallback& callback);
+
+    bool isOpen() const { return !m_data.empty(); }
+    const std::string& getFilename() const { return m_filename; }
+
+private:
+    template<typename T>
+    bool read(T* value);
+
+    bool readEvent(uint8_t tag, const EventCallback& callback);
+
+    std::vector<char> m_data;
+    size_t m_pos{0};
+    std::string m_filename;
+};
+
+} // namespace GE
+
+#endif // GE_WINDOW_INPUT_RECORDING_H_
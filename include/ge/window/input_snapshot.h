@@ -0,0 +1,128 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef GE_WINDOW_INPUT_SNAPSHOT_H_
+#define GE_WINDOW_INPUT_SNAPSHOT_H_
+
+#include <ge/core/core.h>
+#include <ge/window/key_codes.h>
+#include <ge/window/mouse_button_codes.h>
+
+#include <glm/glm.hpp>
+
+#include <bitset>
+
+namespace GE {
+
+// State of keys and mouse buttons captured once per frame, so queries are plain
+// memory reads. 'Just pressed' and 'just released' are the changes since the
+// previous snapshot
+class GE_API InputSnapshot
+{
+public:
+    void nextFrame()
+    {
+        m_prev_keys = m_keys;
+        m_prev_buttons = m_buttons;
+    }
+
+    void reset() { *this = InputSnapshot{}; }
+
+    void setKeyPressed(KeyCode key_code, bool pressed)
+    {
+        if (auto index = toIndex(key_code); index < KEY_CODES_COUNT) {
+            m_keys[index] = pressed;
+        }
+    }
+
+    void setMouseButtonPressed(MouseButton button, bool pressed)
+    {
+        if (auto index = toIndex(button); index < MOUSE_BUTTONS_COUNT) {
+            m_buttons[index] = pressed;
+        }
+    }
+
+    void setMousePos(const glm::vec2& pos) { m_mouse_pos = pos; }
+
+    bool isKeyPressed(KeyCode key_code) const { return test(m_keys, key_code); }
+
+    bool isKeyJustPressed(KeyCode key_code) const
+    {
+        return test(m_keys, key_code) && !test(m_prev_keys, key_code);
+    }
+
+    bool isKeyJustReleased(KeyCode key_code) const
+    {
+        return !test(m_keys, key_code) && test(m_prev_keys, key_code);
+    }
+
+    bool isMouseButtonPressed(MouseButton button) const
+    {
+        return test(m_buttons, button);
+    }
+
+    bool isMouseButtonJustPressed(MouseButton button) const
+    {
+        return test(m_buttons, button) && !test(m_prev_buttons, button);
+    }
+
+    bool isMouseButtonJustReleased(MouseButton button) const
+    {
+        return !test(m_buttons, button) && test(m_prev_buttons, button);
+    }
+
+    const glm::vec2& getMousePos() const { return m_mouse_pos; }
+
+private:
+    template<typename Code>
+    static constexpr size_t toIndex(Code code)
+    {
+        return static_cast<size_t>(code);
+    }
+
+    template<size_t Size, typename Code>
+    static bool test(const std::bitset<Size>& bits, Code code)
+    {
+        auto index = toIndex(code);
+        return index < Size && bits[index];
+    }
+
+    std::bitset<KEY_CODES_COUNT> m_keys;
+    std::bitset<KEY_CODES_COUNT> m_prev_keys;
+    std::bitset<MOUSE_BUTTONS_COUNT> m_buttons;
+    std::bitset<MOUSE_BUTTONS_COUNT> m_prev_buttons;
+    glm::vec2 m_mouse_pos{0.0f, 0.0f};
+};
+
+} // namespace GE
+
+#endif // GE_WINDOW_INPUT_SNAPSHOT_H_
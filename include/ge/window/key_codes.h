@@ -33,6 +33,7 @@
 #ifndef GE_WINDOW_KEY_CODES_H_
 #define GE_WINDOW_KEY_CODES_H_
 
+#include <cstddef>
 #include <iostream>
 
 #define GE_KEY_UNKNOWN ::GE::KeyCode::UNKNOWN
@@ -339,6 +340,8 @@ enum class KeyCode : uint16_t
     MENU = 0x0145
 };
 
+constexpr size_t KEY_CODES_COUNT{static_cast<size_t>(KeyCode::MENU) + 1};
+
 } // namespace GE
 
 inline std::ostream& operator<<(std::ostream& os, GE::KeyCode key_code)
@@ -36,6 +36,8 @@
 #include <ge/window/event.h>
 #include <ge/window/key_codes.h>
 
+#include <array>
+#include <cstring>
 #include <sstream>
 
 namespace GE {
@@ -96,23 +98,29 @@ public:
 class GE_API KeyTypedEvent: public Event
 {
 public:
+    // Text is copied, so the event can be queued after its source is gone
+    static constexpr size_t TEXT_SIZE{32};
+
     explicit KeyTypedEvent(const char* text = nullptr)
-        : m_text{text}
-    {}
+    {
+        if (text != nullptr) {
+            std::strncpy(m_text.data(), text, TEXT_SIZE - 1);
+        }
+    }
 
     std::string toString() const override
     {
         std::stringstream ss;
-        ss << "KeyTypedEvent: " << m_text;
+        ss << "KeyTypedEvent: " << m_text.data();
         return ss.str();
     }
 
-    const char* getText() const { return m_text; }
+    const char* getText() const { return m_text.data(); }
 
     DECLARE_EVENT_TYPE(KEY_TYPED)
 
 private:
-    const char* m_text{nullptr};
+    std::array<char, TEXT_SIZE> m_text{};
 };
 
 } // namespace GE
@@ -33,6 +33,7 @@
 #ifndef GE_WINDOW_MOUSE_BUTTON_CODES_H_
 #define GE_WINDOW_MOUSE_BUTTON_CODES_H_
 
+#include <cstddef>
 #include <iostream>
 
 #define GE_BUTTON_UNKNOWN ::GE::MouseButton::BUTTON_UNKNOWN
@@ -54,6 +55,8 @@ enum class MouseButton : uint8_t
     BUTTON_X2 = 5
 };
 
+constexpr size_t MOUSE_BUTTONS_COUNT{static_cast<size_t>(MouseButton::BUTTON_X2) + 1};
+
 } // namespace GE
 
 inline std::ostream& operator<<(std::ostream& os, GE::MouseButton button)
@@ -0,0 +1,71 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef GE_WINDOW_USER_EVENT_H_
+#define GE_WINDOW_USER_EVENT_H_
+
+#include <ge/window/event.h>
+
+#include <sstream>
+
+namespace GE {
+
+// Event defined by the application, e.g. a notification of a finished background
+// job. 'code' tells what has happened, 'data' is owned by the application
+class GE_API UserEvent: public Event
+{
+public:
+    explicit UserEvent(uint32_t code = 0, void* data = nullptr)
+        : m_code{code}
+        , m_data{data}
+    {}
+
+    uint32_t getCode() const { return m_code; }
+    void* getData() const { return m_data; }
+
+    std::string toString() const override
+    {
+        std::stringstream ss;
+        ss << "UserEvent: " << m_code;
+        return ss.str();
+    }
+
+    DECLARE_EVENT_TYPE(USER)
+
+private:
+    uint32_t m_code{};
+    void* m_data{nullptr};
+};
+
+} // namespace GE
+
+#endif // GE_WINDOW_USER_EVENT_H_
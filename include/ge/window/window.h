@@ -74,6 +74,12 @@ public:
     virtual const properties_t& getProps() const = 0;
 
     virtual void onUpdate() = 0;
+    // Parts of onUpdate(), the pipelined rendering polls events on the main
+    // thread and swaps buffers on the render thread
+    virtual void pollEvents() = 0;
+    virtual void swapBuffers() = 0;
+    virtual void makeContextCurrent() = 0;
+    virtual void releaseContext() = 0;
     virtual void setEventCallback(WinEventCallback callback) = 0;
 
     static Scoped<Window> create(properties_t properties);
@@ -41,6 +41,7 @@
 
 #include <filesystem>
 #include <fstream>
+#include <utility>
 
 namespace {
 
@@ -49,11 +50,48 @@ constexpr auto PROP_GENERAL_CORE_LOGLVL = "general.core_loglvl";
 constexpr auto PROP_GENERAL_CLIENT_LOGLVL = "general.client_loglvl";
 constexpr auto PROP_GENERAL_ASSETS_DIR = "general.assets_dir";
 
+constexpr auto PROP_LOG_ASYNC = "log.async";
+constexpr auto PROP_LOG_QUEUE_SIZE = "log.queue_size";
+constexpr auto PROP_LOG_OVERFLOW_POLICY = "log.overflow_policy";
+constexpr auto PROP_LOG_FILE = "log.file";
+constexpr auto PROP_LOG_FILE_SIZE_MAX = "log.file_size_max";
+constexpr auto PROP_LOG_FILES_COUNT = "log.files_count";
+constexpr auto PROP_LOG_DEFERRED = "log.deferred";
+
 constexpr auto PROP_WINDOW_TITLE = "window.title";
 constexpr auto PROP_WINDOW_WIDTH = "window.width";
 constexpr auto PROP_WINDOW_HEIGHT = "window.height";
 constexpr auto PROP_WINDOW_VSYNC = "window.vsync";
 
+constexpr auto PROP_RENDERER_PIPELINED = "renderer.pipelined";
+
+constexpr auto PROP_FRAME_PACING_TARGET_FPS = "frame_pacing.target_fps";
+constexpr auto PROP_FRAME_PACING_SPIN_TIME = "frame_pacing.spin_time";
+constexpr auto PROP_FRAME_PACING_SMOOTHING_FRAMES = "frame_pacing.smoothing_frames";
+
+constexpr auto PROP_SIMULATION_FIXED_STEP = "simulation.fixed_step";
+constexpr auto PROP_SIMULATION_MAX_STEPS = "simulation.max_steps";
+
+constexpr auto PROP_INPUT_RECORD = "input.record";
+constexpr auto PROP_INPUT_REPLAY = "input.replay";
+
+constexpr auto PROP_HEADLESS_ENABLED = "headless.enabled";
+constexpr auto PROP_HEADLESS_FRAME_TIME = "headless.frame_time";
+constexpr auto PROP_HEADLESS_FRAMES_COUNT = "headless.frames_count";
+
+constexpr std::pair<GE::Debug::MemoryTag, const char*> PROP_MEMORY_BUDGETS[] = {
+    {GE::Debug::MemoryTag::UNTAGGED, "memory.untagged_budget"},
+    {GE::Debug::MemoryTag::RENDERER, "memory.renderer_budget"},
+    {GE::Debug::MemoryTag::TEXTURES, "memory.textures_budget"},
+    {GE::Debug::MemoryTag::ECS, "memory.ecs_budget"},
+    {GE::Debug::MemoryTag::GUI, "memory.gui_budget"},
+    {GE::Debug::MemoryTag::EVENTS, "memory.events_budget"},
+    {GE::Debug::MemoryTag::FRAME_ARENA, "memory.frame_arena_budget"},
+};
+
+static_assert(std::size(PROP_MEMORY_BUDGETS) ==
+              static_cast<size_t>(GE::Debug::MemoryTag::COUNT));
+
 bool createFileIfNotExist(const std::string& filename)
 {
     if (std::filesystem::exists(filename)) {
@@ -78,11 +116,41 @@ void dumpProperties([[maybe_unused]] const GE::AppProperties::properties_t& prop
     GE_CORE_INFO("\tCore log level: {}", GE::toString(props.core_log_lvl));
     GE_CORE_INFO("\tClient log level: {}", GE::toString(props.client_log_lvl));
     GE_CORE_INFO("\tAssets directory: {}", props.assets_dir);
+    GE_CORE_INFO("Log:");
+    GE_CORE_INFO("\tAsync: {}", props.log.async);
+    GE_CORE_INFO("\tQueue size: {}", props.log.queue_size);
+    GE_CORE_INFO("\tOverflow policy: {}", GE::toString(props.log.overflow_policy));
+    GE_CORE_INFO("\tFile: {}", props.log.file);
+    GE_CORE_INFO("\tFile size max: {}", props.log.file_size_max);
+    GE_CORE_INFO("\tFiles count: {}", props.log.files_count);
+    GE_CORE_INFO("\tDeferred: {}", props.log.deferred);
     GE_CORE_INFO("Window:");
     GE_CORE_INFO("\tTitle: {}", props.window.title);
     GE_CORE_INFO("\tWidth: {}", props.window.width);
     GE_CORE_INFO("\tHeight: {}", props.window.height);
     GE_CORE_INFO("\tVSync: {}", props.window.vsync);
+    GE_CORE_INFO("Renderer:");
+    GE_CORE_INFO("\tPipelined: {}", props.pipelined_rendering);
+    GE_CORE_INFO("Frame pacing:");
+    GE_CORE_INFO("\tTarget FPS: {}", props.frame_pacing.target_fps);
+    GE_CORE_INFO("\tSpin time: {}", props.frame_pacing.spin_time);
+    GE_CORE_INFO("\tSmoothing frames: {}", props.frame_pacing.smoothing_frames);
+    GE_CORE_INFO("Simulation:");
+    GE_CORE_INFO("\tFixed step: {}", props.fixed_timestep.step);
+    GE_CORE_INFO("\tMax steps: {}", props.fixed_timestep.max_steps);
+    GE_CORE_INFO("Input:");
+    GE_CORE_INFO("\tRecord: {}", props.record_input);
+    GE_CORE_INFO("\tReplay: {}", props.replay_input);
+    GE_CORE_INFO("Headless:");
+    GE_CORE_INFO("\tEnabled: {}", props.headless);
+    GE_CORE_INFO("\tFrame time: {}", props.headless_props.frame_time);
+    GE_CORE_INFO("\tFrames count: {}", props.headless_props.frames_count);
+    GE_CORE_INFO("Memory budgets:");
+
+    for (const auto& [tag, path] : PROP_MEMORY_BUDGETS) {
+        GE_CORE_INFO("\t{}: {}", GE::Debug::toString(tag),
+                     props.memory_budgets[static_cast<size_t>(tag)]);
+    }
 }
 
 } // namespace
@@ -122,6 +190,22 @@ bool AppProperties::read(const std::string& filename, properties_t* props)
     props->assets_dir =
         ptree.get<std::string>(PROP_GENERAL_ASSETS_DIR, Paths::ASSETS_DIR);
 
+    // log
+    using LogProps = Log::properties_t;
+    std::string overflow_policy =
+        getPropString(ptree, PROP_LOG_OVERFLOW_POLICY, LogProps::OVERFLOW_POLICY_DEFAULT);
+
+    props->log.async = ptree.get<bool>(PROP_LOG_ASYNC, LogProps::ASYNC_DEFAULT);
+    props->log.queue_size =
+        ptree.get<uint32_t>(PROP_LOG_QUEUE_SIZE, LogProps::QUEUE_SIZE_DEFAULT);
+    props->log.overflow_policy = toOverflowPolicy(overflow_policy);
+    props->log.file = ptree.get<std::string>(PROP_LOG_FILE, {});
+    props->log.file_size_max =
+        ptree.get<uint32_t>(PROP_LOG_FILE_SIZE_MAX, LogProps::FILE_SIZE_MAX_DEFAULT);
+    props->log.files_count =
+        ptree.get<uint32_t>(PROP_LOG_FILES_COUNT, LogProps::FILES_COUNT_DEFAULT);
+    props->log.deferred = ptree.get<bool>(PROP_LOG_DEFERRED, LogProps::DEFERRED_DEFAULT);
+
     // window
     using WindowProps = Window::properties_t;
     props->window.title =
@@ -132,6 +216,42 @@ bool AppProperties::read(const std::string& filename, properties_t* props)
         ptree.get<uint32_t>(PROP_WINDOW_HEIGHT, WindowProps::HEIGHT_DEFAULT);
     props->window.vsync = ptree.get<bool>(PROP_WINDOW_VSYNC, WindowProps::VSYNC_DEFAULT);
 
+    // renderer
+    props->pipelined_rendering = ptree.get<bool>(PROP_RENDERER_PIPELINED, false);
+
+    // frame pacing
+    using FramePacingProps = FramePacer::properties_t;
+    props->frame_pacing.target_fps = ptree.get<double>(
+        PROP_FRAME_PACING_TARGET_FPS, FramePacingProps::TARGET_FPS_DEFAULT);
+    props->frame_pacing.spin_time = ptree.get<double>(
+        PROP_FRAME_PACING_SPIN_TIME, FramePacingProps::SPIN_TIME_DEFAULT);
+    props->frame_pacing.smoothing_frames = ptree.get<uint32_t>(
+        PROP_FRAME_PACING_SMOOTHING_FRAMES, FramePacingProps::SMOOTHING_FRAMES_DEFAULT);
+
+    // simulation
+    using FixedTimestepProps = FixedTimestep::properties_t;
+    props->fixed_timestep.step =
+        ptree.get<double>(PROP_SIMULATION_FIXED_STEP, FixedTimestepProps::STEP_DEFAULT);
+    props->fixed_timestep.max_steps = ptree.get<uint32_t>(
+        PROP_SIMULATION_MAX_STEPS, FixedTimestepProps::MAX_STEPS_DEFAULT);
+
+    // input
+    props->record_input = ptree.get<std::string>(PROP_INPUT_RECORD, {});
+    props->replay_input = ptree.get<std::string>(PROP_INPUT_REPLAY, {});
+
+    // headless
+    using HeadlessProps = Application::headless_properties_t;
+    props->headless = ptree.get<bool>(PROP_HEADLESS_ENABLED, false);
+    props->headless_props.frame_time =
+        ptree.get<double>(PROP_HEADLESS_FRAME_TIME, HeadlessProps::FRAME_TIME_DEFAULT);
+    props->headless_props.frames_count = ptree.get<uint64_t>(
+        PROP_HEADLESS_FRAMES_COUNT, HeadlessProps::FRAMES_COUNT_DEFAULT);
+
+    // memory
+    for (const auto& [tag, path] : PROP_MEMORY_BUDGETS) {
+        props->memory_budgets[static_cast<size_t>(tag)] = ptree.get<uint64_t>(path, 0);
+    }
+
     GE_CORE_INFO("Reading app properties: Succeed", filename);
     dumpProperties(*props);
 
@@ -155,12 +275,50 @@ bool AppProperties::write(const std::string& filename, const properties_t& props
                                toString(props.client_log_lvl));
         ptree.put<std::string>(PROP_GENERAL_ASSETS_DIR, props.assets_dir);
 
+        // log
+        ptree.put<bool>(PROP_LOG_ASYNC, props.log.async);
+        ptree.put<uint32_t>(PROP_LOG_QUEUE_SIZE, props.log.queue_size);
+        ptree.put<std::string>(PROP_LOG_OVERFLOW_POLICY,
+                               toString(props.log.overflow_policy));
+        ptree.put<std::string>(PROP_LOG_FILE, props.log.file);
+        ptree.put<uint32_t>(PROP_LOG_FILE_SIZE_MAX, props.log.file_size_max);
+        ptree.put<uint32_t>(PROP_LOG_FILES_COUNT, props.log.files_count);
+        ptree.put<bool>(PROP_LOG_DEFERRED, props.log.deferred);
+
         // window
         ptree.put<std::string>(PROP_WINDOW_TITLE, props.window.title);
         ptree.put<uint32_t>(PROP_WINDOW_WIDTH, props.window.width);
         ptree.put<uint32_t>(PROP_WINDOW_HEIGHT, props.window.height);
         ptree.put<bool>(PROP_WINDOW_VSYNC, props.window.vsync);
 
+        // renderer
+        ptree.put<bool>(PROP_RENDERER_PIPELINED, props.pipelined_rendering);
+
+        // frame pacing
+        ptree.put<double>(PROP_FRAME_PACING_TARGET_FPS, props.frame_pacing.target_fps);
+        ptree.put<double>(PROP_FRAME_PACING_SPIN_TIME, props.frame_pacing.spin_time);
+        ptree.put<uint32_t>(PROP_FRAME_PACING_SMOOTHING_FRAMES,
+                            props.frame_pacing.smoothing_frames);
+
+        // simulation
+        ptree.put<double>(PROP_SIMULATION_FIXED_STEP, props.fixed_timestep.step);
+        ptree.put<uint32_t>(PROP_SIMULATION_MAX_STEPS, props.fixed_timestep.max_steps);
+
+        // input
+        ptree.put<std::string>(PROP_INPUT_RECORD, props.record_input);
+        ptree.put<std::string>(PROP_INPUT_REPLAY, props.replay_input);
+
+        // headless
+        ptree.put<bool>(PROP_HEADLESS_ENABLED, props.headless);
+        ptree.put<double>(PROP_HEADLESS_FRAME_TIME, props.headless_props.frame_time);
+        ptree.put<uint64_t>(PROP_HEADLESS_FRAMES_COUNT,
+                            props.headless_props.frames_count);
+
+        // memory
+        for (const auto& [tag, path] : PROP_MEMORY_BUDGETS) {
+            ptree.put<uint64_t>(path, props.memory_budgets[static_cast<size_t>(tag)]);
+        }
+
         boost::property_tree::ini_parser::write_ini(filename, ptree);
     } catch (const std::exception& e) {
         GE_CORE_ERR("Failed to write properties to '{}", filename);
@@ -34,11 +34,16 @@
 
 #include "ge/core/asserts.h"
 #include "ge/core/begin.h"
+#include "ge/core/frame_arena.h"
 #include "ge/core/log.h"
+#include "ge/debug/counters.h"
+#include "ge/debug/memory.h"
 #include "ge/debug/profile.h"
 #include "ge/gui/gui.h"
 #include "ge/layer.h"
+#include "ge/renderer/gpu_profiler.h"
 #include "ge/renderer/renderer.h"
+#include "ge/window/input.h"
 #include "ge/window/window.h"
 #include "ge/window/window_event.h"
 
@@ -56,17 +61,47 @@ bool Application::initialize(const Window::properties_t& window_props)
         return false;
     }
 
-    window->setEventCallback([](Event* event) { get()->onEvent(event); });
+    window->setEventCallback([](Event* event) { get()->onWindowEvent(event); });
 
     return true;
 }
 
+bool Application::initializeHeadless(const Window::properties_t& window_props,
+                                     const headless_properties_t& props)
+{
+    GE_PROFILE_FUNC();
+    GE_CORE_DBG("Initialize headless Application");
+
+    if (!RendererAPI::isHeadless(Renderer::getAPI())) {
+        GE_CORE_ERR("Headless Application requires a headless render API, '{}' is used",
+                    toString(Renderer::getAPI()));
+        return false;
+    }
+
+    // The window is a headless one with the headless render API
+    if (!initialize(window_props)) {
+        return false;
+    }
+
+    get()->m_headless = true;
+    get()->m_headless_props = props;
+    return true;
+}
+
 void Application::shutdown()
 {
     GE_PROFILE_FUNC();
 
     GE_CORE_DBG("Shutdown Application");
+    GE_PROFILE_GPU_SHUTDOWN();
+    get()->m_input_recorder.close();
+    get()->m_input_replay.close();
+    get()->m_event_queue.clear();
+    get()->m_layer_stack.clear();
     get()->m_window.reset();
+    get()->m_running = true;
+    get()->m_headless = false;
+    get()->m_headless_props = {};
 }
 
 void Application::run()
@@ -83,6 +118,22 @@ void Application::close()
     get()->m_running = false;
 }
 
+bool Application::recordInput(const std::string& filename)
+{
+    GE_PROFILE_FUNC();
+
+    get()->m_input_recorder.close();
+    return get()->m_input_recorder.open(filename);
+}
+
+bool Application::replayInput(const std::string& filename)
+{
+    GE_PROFILE_FUNC();
+
+    get()->m_input_replay.close();
+    return get()->m_input_replay.open(filename);
+}
+
 void Application::pushLayer(Shared<Layer> layer)
 {
     GE_PROFILE_FUNC();
@@ -102,20 +153,83 @@ void Application::pushOverlay(Shared<Layer> overlay)
 void Application::mainLoop()
 {
     GE_PROFILE_FUNC();
-    m_prev_frame_time = Timestamp::now();
+    m_frame_pacer.reset();
+
+    if (m_pipelined_rendering && !m_render_thread.start(m_window.get())) {
+        GE_CORE_WARN("Failed to start render thread, frames are rendered sequentially");
+    }
 
     while (m_running) {
+        GE_PROFILE_FRAME_MARK();
         GE_PROFILE_SCOPE("MainLoop");
+        FrameArena::nextFrame();
+
+        Timestamp delta_time = m_frame_pacer.beginFrame();
+
+        if (m_headless && m_headless_props.frame_time > 0.0) {
+            delta_time = m_headless_props.frame_time;
+        }
+
+        // Replayed frames take the recorded time, so the session is repeatable
+        if (m_input_replay.isOpen() && !m_input_replay.nextFrame(&delta_time)) {
+            GE_CORE_INFO("Input replay '{}' has finished", m_input_replay.getFilename());
+            m_input_replay.close();
+            break;
+        }
 
-        Timestamp now = Timestamp::now();
-        Timestamp delta_time = now - m_prev_frame_time;
-        m_prev_frame_time = now;
+        if (m_input_recorder.isOpen()) {
+            m_input_recorder.beginFrame(delta_time);
+        }
 
         if (m_window_state != WindowState::MINIMIZED) {
+            updateFixedLayers(delta_time);
             updateLayers(delta_time);
         }
 
-        m_window->onUpdate();
+        if (m_render_thread.isRunning()) {
+            submitFrame();
+            m_window->pollEvents();
+        } else {
+            m_window->onUpdate();
+            GE_PROFILE_GPU_COLLECT();
+        }
+
+        updateInput();
+        dispatchEvents();
+        Debug::Memory::mergeFrame();
+        Debug::Counters::mergeFrame();
+        m_frame_pacer.endFrame();
+
+        if (m_headless && m_frame_pacer.getStats().frames_count ==
+                              m_headless_props.frames_count) {
+            GE_CORE_INFO("Headless run has finished after {} frames",
+                         m_headless_props.frames_count);
+            break;
+        }
+    }
+
+    m_render_thread.stop();
+}
+
+void Application::updateFixedLayers(Timestamp delta_time)
+{
+    GE_PROFILE_FUNC();
+
+    uint64_t dropped_steps = m_fixed_timestep.getDroppedSteps();
+    uint32_t steps = m_fixed_timestep.advance(delta_time);
+    Timestamp step = m_fixed_timestep.getStep();
+
+    if (m_fixed_timestep.getDroppedSteps() != dropped_steps) {
+        GE_CORE_WARN_PER_SEC(1, "Simulation is behind, {} fixed steps have been dropped",
+                             m_fixed_timestep.getDroppedSteps() - dropped_steps);
+    }
+
+    for (uint32_t i{0}; i < steps; i++) {
+        GE_PROFILE_SCOPE("LayerStack onFixedUpdate");
+
+        for (auto& layer : m_layer_stack) {
+            layer->onFixedUpdate(step);
+        }
     }
 }
 
@@ -131,6 +245,12 @@ void Application::updateLayers(Timestamp delta_time)
         }
     }
 
+    // The GUI renders right away to the window, so it's drawn by the sequential
+    // loop only
+    if (m_render_thread.isRunning() || m_headless) {
+        return;
+    }
+
     {
         GE_PROFILE_SCOPE("LayerStack onGuiRender");
         Begin<Gui> begin;
@@ -141,18 +261,91 @@ void Application::updateLayers(Timestamp delta_time)
     }
 }
 
-void Application::onEvent(Event* event)
+void Application::updateInput()
+{
+    GE_PROFILE_FUNC();
+
+    if (!m_input_replay.isOpen()) {
+        Input::update();
+        return;
+    }
+
+    Input::beginReplayFrame();
+    m_input_replay.readEvents([this](const Event& event) {
+        Input::replayEvent(event);
+        m_event_queue.push(event);
+    });
+}
+
+void Application::submitFrame()
+{
+    GE_PROFILE_FUNC();
+
+    RenderSnapshot* snapshot = m_render_thread.getSnapshot();
+    snapshot->setViewport(m_window->getWidth(), m_window->getHeight());
+    snapshot->setInterpolationAlpha(m_fixed_timestep.getAlpha());
+
+    if (m_window_state != WindowState::MINIMIZED) {
+        GE_PROFILE_SCOPE("LayerStack onExtract");
+
+        for (auto& layer : m_layer_stack) {
+            layer->onExtract(snapshot);
+        }
+    }
+
+    m_render_thread.submit();
+}
+
+void Application::dispatchEvents()
 {
     GE_PROFILE_FUNC();
 
-    EventDispatcher dispatcher{event};
-    dispatcher.dispatch<WindowResizedEvent>(Renderer::onWindowResized);
-    dispatcher.dispatch<WindowClosedEvent>(GE_BIND_EVENT_FN(onWindowClosed));
-    dispatcher.dispatch<WindowMaximizedEvent>(GE_BIND_EVENT_FN(onWindowMaximized));
-    dispatcher.dispatch<WindowMinimizedEvent>(GE_BIND_EVENT_FN(onWindowMinimized));
-    dispatcher.dispatch<WindowRestoredEvent>(GE_BIND_EVENT_FN(onWindowRestored));
+    m_event_queue.dispatch([this](Event* event) { onEvent(event); });
+    m_event_channel.drain([this](Event* event) { onEvent(event); });
+
+    if (auto dropped = m_event_channel.getDroppedEvents();
+        dropped != m_reported_dropped_events) {
+        GE_CORE_WARN("{} posted events have been dropped",
+                     dropped - m_reported_dropped_events);
+        m_reported_dropped_events = dropped;
+    }
+}
+
+void Application::onWindowEvent(Event* event)
+{
+    // Replayed input replaces the real one, only closing the window is allowed
+    if (m_input_replay.isOpen() && event->getType() != Event::Type::WINDOW_CLOSED) {
+        return;
+    }
+
+    if (m_input_recorder.isOpen()) {
+        m_input_recorder.record(*event);
+    }
 
-    Gui::onEvent(event);
+    m_event_queue.push(*event);
+}
+
+void Application::onEvent(Event* event)
+{
+    GE_PROFILE_FUNC();
+    GE_MEMORY_TAG(Debug::MemoryTag::EVENTS);
+
+    static const auto handlers = [] {
+        EventHandlerTable<Application> handlers;
+        handlers.add<WindowResizedEvent, &Application::onWindowResized>();
+        handlers.add<WindowClosedEvent, &Application::onWindowClosed>();
+        handlers.add<WindowMaximizedEvent, &Application::onWindowMaximized>();
+        handlers.add<WindowMinimizedEvent, &Application::onWindowMinimized>();
+        handlers.add<WindowRestoredEvent, &Application::onWindowRestored>();
+        return handlers;
+    }();
+
+    handlers.dispatch(event, this);
+
+    // The GUI sets the viewport on resizing, the render thread owns the context
+    if (!m_headless && !m_render_thread.isRunning()) {
+        Gui::onEvent(event);
+    }
 
     for (auto layer = m_layer_stack.rbegin(); layer != m_layer_stack.rend(); ++layer) {
         if (event->handled()) {
@@ -163,6 +356,18 @@ void Application::onEvent(Event* event)
     }
 }
 
+bool Application::onWindowResized(const WindowResizedEvent& event)
+{
+    GE_PROFILE_FUNC();
+
+    // The render thread takes the viewport from the snapshot
+    if (m_render_thread.isRunning()) {
+        return false;
+    }
+
+    return Renderer::onWindowResized(event);
+}
+
 bool Application::onWindowClosed([[maybe_unused]] const WindowClosedEvent& event)
 {
     GE_PROFILE_FUNC();
@@ -0,0 +1,156 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "frame_arena.h"
+
+#include "ge/debug/memory.h"
+#include "ge/debug/profile.h"
+
+#include <algorithm>
+#include <atomic>
+
+namespace {
+
+struct thread_arenas_t {
+    GE::LinearArena arenas[2];
+    uint64_t frame_idx{UINT64_MAX};
+};
+
+std::atomic<uint64_t> g_frame_idx{0};
+
+size_t alignUp(size_t value, size_t alignment)
+{
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+} // namespace
+
+namespace GE {
+
+LinearArena::LinearArena(size_t block_size)
+    : m_block_size{block_size}
+{}
+
+LinearArena::~LinearArena()
+{
+    for (auto& block : m_blocks) {
+        Debug::Memory::deallocate(block.data);
+    }
+}
+
+void* LinearArena::allocate(size_t size, size_t alignment)
+{
+    void* ptr{nullptr};
+
+    for (; m_block_idx < m_blocks.size(); m_block_idx++) {
+        if (allocateFromBlock(size, alignment, &ptr)) {
+            return ptr;
+        }
+
+        m_used_size += m_blocks[m_block_idx].size;
+        m_offset = 0;
+    }
+
+    GE_PROFILE_SCOPE("LinearArena: new block");
+    block_t block{};
+    // The padding of the first allocation in a block is less than the alignment
+    block.size = std::max(m_block_size, size + alignment);
+    block.data = static_cast<uint8_t*>(
+        Debug::Memory::allocate(block.size, Debug::MemoryTag::FRAME_ARENA));
+    m_blocks.push_back(block);
+    allocateFromBlock(size, alignment, &ptr);
+    return ptr;
+}
+
+void LinearArena::reset()
+{
+    m_block_idx = 0;
+    m_offset = 0;
+    m_used_size = 0;
+}
+
+size_t LinearArena::getUsedSize() const
+{
+    return m_used_size + m_offset;
+}
+
+size_t LinearArena::getCapacity() const
+{
+    size_t capacity{0};
+
+    for (const auto& block : m_blocks) {
+        capacity += block.size;
+    }
+
+    return capacity;
+}
+
+bool LinearArena::allocateFromBlock(size_t size, size_t alignment, void** ptr)
+{
+    const auto& block = m_blocks[m_block_idx];
+    auto address = reinterpret_cast<uintptr_t>(block.data) + m_offset;
+    size_t offset = m_offset + alignUp(address, alignment) - address;
+
+    if (offset + size > block.size) {
+        return false;
+    }
+
+    *ptr = block.data + offset;
+    m_offset = offset + size;
+    return true;
+}
+
+LinearArena* FrameArena::get()
+{
+    thread_local thread_arenas_t thread_arenas;
+    uint64_t frame_idx = g_frame_idx.load(std::memory_order_relaxed);
+    auto* arena = &thread_arenas.arenas[frame_idx % 2];
+
+    if (thread_arenas.frame_idx != frame_idx) {
+        thread_arenas.frame_idx = frame_idx;
+        arena->reset();
+    }
+
+    return arena;
+}
+
+void FrameArena::nextFrame()
+{
+    g_frame_idx.fetch_add(1, std::memory_order_relaxed);
+}
+
+uint64_t FrameArena::getFrameIdx()
+{
+    return g_frame_idx.load(std::memory_order_relaxed);
+}
+
+} // namespace GE
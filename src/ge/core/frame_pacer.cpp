@@ -0,0 +1,127 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "frame_pacer.h"
+
+#include "ge/debug/counters.h"
+#include "ge/debug/profile.h"
+
+#include <algorithm>
+#include <thread>
+
+namespace GE {
+
+FramePacer::FramePacer(const properties_t& props)
+    : m_props{props}
+{
+    reset();
+}
+
+void FramePacer::reset(Timestamp now)
+{
+    m_frame_begin = now;
+    m_deadline = now + getFramePeriod();
+    m_frame_times.assign(std::max(m_props.smoothing_frames, 1u), 0.0);
+    m_frame_time_idx = 0;
+    m_frame_times_sum = 0.0;
+    m_stats = {};
+}
+
+Timestamp FramePacer::beginFrame(Timestamp now)
+{
+    GE_PROFILE_FUNC();
+
+    Timestamp frame_time = now - m_frame_begin;
+    m_frame_begin = now;
+    m_stats.frames_count++;
+
+    if (m_frame_times.size() <= 1) {
+        return frame_time;
+    }
+
+    // Until the window is full, the average is taken over the frames there are
+    m_frame_times_sum += frame_time.sec() - m_frame_times[m_frame_time_idx];
+    m_frame_times[m_frame_time_idx] = frame_time.sec();
+    m_frame_time_idx = (m_frame_time_idx + 1) % m_frame_times.size();
+
+    auto frames = std::min<uint64_t>(m_stats.frames_count, m_frame_times.size());
+    return m_frame_times_sum / static_cast<double>(frames);
+}
+
+void FramePacer::endFrame()
+{
+    GE_PROFILE_FUNC();
+
+    if (!isLimited()) {
+        return;
+    }
+
+    Timestamp now = Timestamp::now();
+
+    if (now >= m_deadline) {
+        m_stats.missed_deadlines++;
+        m_deadline = now + getFramePeriod();
+        GE_COUNTER("Missed frame deadlines", 1);
+        return;
+    }
+
+    waitUntil(m_deadline);
+    m_deadline += getFramePeriod();
+}
+
+Timestamp FramePacer::getFramePeriod() const
+{
+    return isLimited() ? 1.0 / m_props.target_fps : 0.0;
+}
+
+void FramePacer::waitUntil(Timestamp deadline)
+{
+    GE_PROFILE_FUNC();
+
+    Timestamp sleep_begin = Timestamp::now();
+    Timestamp sleep_time = deadline - sleep_begin - Timestamp{m_props.spin_time};
+
+    if (sleep_time > 0.0) {
+        std::this_thread::sleep_for(Timestamp::DurationSec{sleep_time.sec()});
+    }
+
+    Timestamp spin_begin = Timestamp::now();
+
+    while (Timestamp::now() < deadline) {
+        std::this_thread::yield();
+    }
+
+    m_stats.sleep_time += spin_begin - sleep_begin;
+    m_stats.spin_time += Timestamp::now() - spin_begin;
+}
+
+} // namespace GE
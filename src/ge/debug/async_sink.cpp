@@ -0,0 +1,209 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "async_sink.h"
+
+#include <spdlog/fmt/fmt.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string_view>
+
+namespace {
+
+// Producers don't take the mutex, so a wake up can be missed, then the writer
+// sleeps no longer than the period
+constexpr std::chrono::milliseconds WRITER_SLEEP_PERIOD{10};
+
+constexpr std::string_view DROPPED_LOGGER_NAME{"LOG"};
+
+} // namespace
+
+namespace GE {
+
+AsyncSink::AsyncSink(std::vector<spdlog::sink_ptr> sinks, size_t queue_size,
+                     Log::OverflowPolicy overflow_policy)
+    : m_sinks{std::move(sinks)}
+    , m_queue{queue_size}
+    , m_overflow_policy{overflow_policy}
+    , m_writer{[this] { writerThread(); }}
+{}
+
+AsyncSink::~AsyncSink()
+{
+    m_running = false;
+    wakeUpWriter();
+    m_writer.join();
+}
+
+void AsyncSink::log(const spdlog::details::log_msg& msg)
+{
+    message_t message{};
+    message.time = msg.time;
+    message.logger_name_size = std::min(msg.logger_name.size(), LOGGER_NAME_SIZE_MAX);
+    std::copy_n(msg.logger_name.data(), message.logger_name_size,
+                message.logger_name.begin());
+    message.thread_id = msg.thread_id;
+    message.level = msg.level;
+    message.size = msg.payload.size();
+
+    if (message.size <= INLINE_PAYLOAD_SIZE) {
+        std::copy_n(msg.payload.data(), message.size, message.payload.begin());
+    } else {
+        message.long_payload.assign(msg.payload.data(), msg.payload.size());
+    }
+
+    while (!m_queue.tryPush(std::move(message))) {
+        if (m_overflow_policy == Log::OverflowPolicy::DROP) {
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        wakeUpWriter();
+        std::this_thread::yield();
+    }
+
+    m_pushed.fetch_add(1, std::memory_order_release);
+
+    if (m_is_sleeping.load()) {
+        wakeUpWriter();
+    }
+}
+
+void AsyncSink::flush()
+{
+    uint64_t pushed = m_pushed.load(std::memory_order_acquire);
+
+    while (m_written.load(std::memory_order_acquire) < pushed) {
+        wakeUpWriter();
+        std::this_thread::yield();
+    }
+
+    for (auto& sink : m_sinks) {
+        sink->flush();
+    }
+}
+
+void AsyncSink::set_pattern(const std::string& pattern)
+{
+    for (auto& sink : m_sinks) {
+        sink->set_pattern(pattern);
+    }
+}
+
+void AsyncSink::set_formatter(std::unique_ptr<spdlog::formatter> sink_formatter)
+{
+    for (auto& sink : m_sinks) {
+        sink->set_formatter(sink_formatter->clone());
+    }
+}
+
+void AsyncSink::writerThread()
+{
+    message_t message{};
+
+    while (true) {
+        if (m_queue.tryPop(&message)) {
+            write(message);
+            m_written.fetch_add(1, std::memory_order_release);
+            continue;
+        }
+
+        reportDropped();
+
+        if (!m_running) {
+            break;
+        }
+
+        std::unique_lock lock{m_wakeup_mtx};
+        m_is_sleeping = true;
+        m_wakeup.wait_for(lock, WRITER_SLEEP_PERIOD,
+                          [this] { return !m_queue.isEmpty() || !m_running; });
+        m_is_sleeping = false;
+    }
+}
+
+void AsyncSink::write(const message_t& message)
+{
+    spdlog::string_view_t payload = message.size <= INLINE_PAYLOAD_SIZE
+                                        ? spdlog::string_view_t{message.payload.data(),
+                                                                message.size}
+                                        : spdlog::string_view_t{message.long_payload};
+    spdlog::string_view_t logger_name{message.logger_name.data(),
+                                      message.logger_name_size};
+    spdlog::details::log_msg msg{message.time, spdlog::source_loc{}, logger_name,
+                                 message.level, payload};
+    msg.thread_id = message.thread_id;
+
+    for (auto& sink : m_sinks) {
+        if (!sink->should_log(msg.level)) {
+            continue;
+        }
+
+        try {
+            sink->log(msg);
+        } catch (const spdlog::spdlog_ex& e) {
+            std::cerr << "Failed to write log message: " << e.what() << std::endl;
+        }
+    }
+}
+
+void AsyncSink::reportDropped()
+{
+    uint64_t dropped = m_dropped.load(std::memory_order_relaxed);
+
+    if (dropped == m_reported_dropped) {
+        return;
+    }
+
+    auto text = fmt::format("{} log messages have been dropped",
+                            dropped - m_reported_dropped);
+    m_reported_dropped = dropped;
+
+    message_t message{};
+    message.time = spdlog::log_clock::now();
+    message.logger_name_size = DROPPED_LOGGER_NAME.size();
+    std::copy_n(DROPPED_LOGGER_NAME.data(), message.logger_name_size,
+                message.logger_name.begin());
+    message.level = spdlog::level::warn;
+    message.size = std::min(text.size(), INLINE_PAYLOAD_SIZE);
+    std::copy_n(text.data(), message.size, message.payload.begin());
+    write(message);
+}
+
+void AsyncSink::wakeUpWriter()
+{
+    m_wakeup.notify_one();
+}
+
+} // namespace GE
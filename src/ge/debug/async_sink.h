@@ -0,0 +1,109 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// NOLINTNEXTLINE
+#ifndef GE_DEBUG_ASYNC_SINK_H_
+#define GE_DEBUG_ASYNC_SINK_H_
+
+#include "ge/core/bounded_queue.h"
+#include "ge/core/log.h"
+
+#include <spdlog/sinks/sink.h>
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace GE {
+
+// Copies messages into a bounded queue, the writer thread passes them to the
+// underlying sinks. If the queue is full, the logging thread either waits for
+// the writer or drops the message, dropped messages are reported by the writer
+class AsyncSink: public spdlog::sinks::sink
+{
+public:
+    AsyncSink(std::vector<spdlog::sink_ptr> sinks, size_t queue_size,
+              Log::OverflowPolicy overflow_policy);
+    ~AsyncSink() override;
+
+    void log(const spdlog::details::log_msg& msg) override;
+    void flush() override;
+    void set_pattern(const std::string& pattern) override;
+    void set_formatter(std::unique_ptr<spdlog::formatter> sink_formatter) override;
+
+    uint64_t getDroppedMessages() const
+    {
+        return m_dropped.load(std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr size_t INLINE_PAYLOAD_SIZE{256};
+    static constexpr size_t LOGGER_NAME_SIZE_MAX{16};
+
+    struct message_t {
+        spdlog::log_clock::time_point time;
+        std::array<char, LOGGER_NAME_SIZE_MAX> logger_name{};
+        size_t logger_name_size{};
+        size_t thread_id{};
+        spdlog::level::level_enum level{spdlog::level::off};
+        size_t size{};
+        std::array<char, INLINE_PAYLOAD_SIZE> payload{};
+        std::string long_payload;
+    };
+
+    void writerThread();
+    void write(const message_t& message);
+    void reportDropped();
+    void wakeUpWriter();
+
+    std::vector<spdlog::sink_ptr> m_sinks;
+    BoundedQueue<message_t> m_queue;
+    Log::OverflowPolicy m_overflow_policy{Log::OverflowPolicy::BLOCK};
+
+    std::atomic<uint64_t> m_pushed{0};
+    std::atomic<uint64_t> m_written{0};
+    std::atomic<uint64_t> m_dropped{0};
+    uint64_t m_reported_dropped{0};
+
+    std::atomic_bool m_running{true};
+    std::atomic_bool m_is_sleeping{false};
+    std::mutex m_wakeup_mtx;
+    std::condition_variable m_wakeup;
+    std::thread m_writer;
+};
+
+} // namespace GE
+
+#endif // GE_DEBUG_ASYNC_SINK_H_
@@ -0,0 +1,279 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "binary_trace_reader.h"
+
+#include "ge/core/log.h"
+
+#include <cstring>
+
+#if defined(GE_TRACE_LZ4)
+    #include <lz4.h>
+#endif
+
+namespace GE::Debug {
+
+BinaryTraceReader::~BinaryTraceReader()
+{
+    if (m_file != nullptr) {
+        std::fclose(m_file);
+    }
+}
+
+bool BinaryTraceReader::open(const std::string& filepath)
+{
+    m_file = std::fopen(filepath.c_str(), "rb");
+
+    if (m_file == nullptr) {
+        GE_CORE_ERR("Unable to open trace file '{}'", filepath);
+        return false;
+    }
+
+    char header[sizeof(Trace::MAGIC) + sizeof(uint32_t)]{};
+
+    if (std::fread(header, 1, sizeof(header), m_file) != sizeof(header) ||
+        std::memcmp(header, Trace::MAGIC, sizeof(Trace::MAGIC)) != 0) {
+        GE_CORE_ERR("File '{}' is not a trace", filepath);
+        return false;
+    }
+
+    if (uint32_t version = Trace::readU32(header + sizeof(Trace::MAGIC));
+        version == 0 || version > Trace::VERSION) {
+        GE_CORE_ERR("Unsupported trace version: {}", version);
+        return false;
+    }
+
+    Trace::Chunk type{};
+    return readChunk(&type) && type == Trace::Chunk::SESSION && readSession();
+}
+
+bool BinaryTraceReader::read(std::vector<trace_event_t>* events,
+                             std::vector<trace_counter_t>* counters)
+{
+    Trace::Chunk type{};
+
+    while (m_file != nullptr && !m_completed && readChunk(&type)) {
+        switch (type) {
+            case Trace::Chunk::STRINGS:
+                if (!readStrings()) {
+                    return false;
+                }
+                break;
+            case Trace::Chunk::EVENTS: return readEvents(events);
+            case Trace::Chunk::COUNTERS:
+                if (counters != nullptr) {
+                    return readCounters(counters);
+                }
+                break;
+            case Trace::Chunk::END: readEnd(); return false;
+            default:
+                GE_CORE_ERR("Unexpected trace chunk: {}", static_cast<uint32_t>(type));
+                return false;
+        }
+    }
+
+    return false;
+}
+
+bool BinaryTraceReader::readChunk(Trace::Chunk* type)
+{
+    char header[Trace::CHUNK_HEADER_SIZE]{};
+
+    if (std::fread(header, 1, sizeof(header), m_file) != sizeof(header)) {
+        GE_CORE_ERR("Trace is truncated");
+        return false;
+    }
+
+    *type = static_cast<Trace::Chunk>(header[0]);
+    auto compression = static_cast<Trace::Compression>(header[1]);
+    uint32_t raw_size = Trace::readU32(header + 2);
+    uint32_t stored_size = Trace::readU32(header + 6);
+
+    m_stored.resize(stored_size);
+
+    if (std::fread(m_stored.data(), 1, stored_size, m_file) != stored_size) {
+        GE_CORE_ERR("Trace is truncated");
+        return false;
+    }
+
+    if (compression == Trace::Compression::NONE) {
+        m_payload.swap(m_stored);
+        return true;
+    }
+
+#if defined(GE_TRACE_LZ4)
+    if (compression == Trace::Compression::LZ4) {
+        m_payload.resize(raw_size);
+        int size = LZ4_decompress_safe(m_stored.data(), m_payload.data(),
+                                       static_cast<int>(stored_size),
+                                       static_cast<int>(raw_size));
+
+        if (size != static_cast<int>(raw_size)) {
+            GE_CORE_ERR("Failed to decompress trace chunk");
+            return false;
+        }
+
+        return true;
+    }
+#else
+    GE_UNUSED(raw_size);
+#endif
+
+    GE_CORE_ERR("Unsupported trace compression: {}", static_cast<uint32_t>(compression));
+    return false;
+}
+
+bool BinaryTraceReader::readSession()
+{
+    const char* data = m_payload.data();
+    const char* end = data + m_payload.size();
+    uint64_t size{0};
+
+    if (!Trace::readVarint(&data, end, &size) ||
+        size > static_cast<uint64_t>(end - data)) {
+        GE_CORE_ERR("Corrupted trace session");
+        return false;
+    }
+
+    m_session_name.assign(data, size);
+    return true;
+}
+
+bool BinaryTraceReader::readStrings()
+{
+    const char* data = m_payload.data();
+    const char* end = data + m_payload.size();
+
+    while (data != end) {
+        uint64_t size{0};
+
+        if (!Trace::readVarint(&data, end, &size) ||
+            size > static_cast<uint64_t>(end - data)) {
+            GE_CORE_ERR("Corrupted trace string table");
+            return false;
+        }
+
+        m_strings.emplace_back(data, size);
+        data += size;
+    }
+
+    return true;
+}
+
+bool BinaryTraceReader::readEvents(std::vector<trace_event_t>* events)
+{
+    const char* data = m_payload.data();
+    const char* end = data + m_payload.size();
+
+    while (data != end) {
+        uint64_t tid{0};
+        uint64_t count{0};
+
+        if (!Trace::readVarint(&data, end, &tid) ||
+            !Trace::readVarint(&data, end, &count)) {
+            GE_CORE_ERR("Corrupted trace events");
+            return false;
+        }
+
+        int64_t start{0};
+
+        for (uint64_t i{0}; i < count; i++) {
+            uint64_t name_idx{0};
+            uint64_t start_delta{0};
+            uint64_t duration{0};
+
+            if (!Trace::readVarint(&data, end, &name_idx) ||
+                !Trace::readVarint(&data, end, &start_delta) ||
+                !Trace::readVarint(&data, end, &duration) ||
+                name_idx >= m_strings.size()) {
+                GE_CORE_ERR("Corrupted trace events");
+                return false;
+            }
+
+            start += Trace::decodeZigzag(start_delta);
+            events->push_back({m_strings[name_idx].c_str(), start,
+                               start + static_cast<int64_t>(duration),
+                               static_cast<uint32_t>(tid)});
+        }
+    }
+
+    return true;
+}
+
+bool BinaryTraceReader::readCounters(std::vector<trace_counter_t>* counters)
+{
+    const char* data = m_payload.data();
+    const char* end = data + m_payload.size();
+    uint64_t count{0};
+
+    if (!Trace::readVarint(&data, end, &count)) {
+        GE_CORE_ERR("Corrupted trace counters");
+        return false;
+    }
+
+    int64_t time{0};
+
+    for (uint64_t i{0}; i < count; i++) {
+        uint64_t name_idx{0};
+        uint64_t time_delta{0};
+        uint64_t value{0};
+
+        if (!Trace::readVarint(&data, end, &name_idx) ||
+            !Trace::readVarint(&data, end, &time_delta) ||
+            !Trace::readVarint(&data, end, &value) || name_idx >= m_strings.size()) {
+            GE_CORE_ERR("Corrupted trace counters");
+            return false;
+        }
+
+        time += Trace::decodeZigzag(time_delta);
+        counters->push_back(
+            {m_strings[name_idx].c_str(), time, Trace::decodeZigzag(value)});
+    }
+
+    return true;
+}
+
+bool BinaryTraceReader::readEnd()
+{
+    const char* data = m_payload.data();
+    const char* end = data + m_payload.size();
+
+    if (!Trace::readVarint(&data, end, &m_dropped_count)) {
+        GE_CORE_ERR("Corrupted trace end");
+        return false;
+    }
+
+    m_completed = true;
+    return true;
+}
+
+} // namespace GE::Debug
@@ -0,0 +1,84 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// NOLINTNEXTLINE
+#ifndef GE_DEBUG_BINARY_TRACE_READER_H_
+#define GE_DEBUG_BINARY_TRACE_READER_H_
+
+#include "trace_format.h"
+
+#include "ge/core/non_copyable.h"
+
+#include <cstdio>
+#include <deque>
+#include <vector>
+
+namespace GE::Debug {
+
+class BinaryTraceReader: public NonCopyable
+{
+public:
+    ~BinaryTraceReader() override;
+
+    bool open(const std::string& filepath);
+
+    // Appends samples of the next events or counters chunk. Counters are
+    // skipped if 'counters' is null. Returns false when the trace has ended,
+    // 'isCompleted()' tells whether it has been read entirely
+    bool read(std::vector<trace_event_t>* events,
+              std::vector<trace_counter_t>* counters = nullptr);
+
+    bool isCompleted() const { return m_completed; }
+    const std::string& getSessionName() const { return m_session_name; }
+    uint64_t getDroppedCount() const { return m_dropped_count; }
+
+private:
+    bool readChunk(Trace::Chunk* type);
+    bool readSession();
+    bool readStrings();
+    bool readEvents(std::vector<trace_event_t>* events);
+    bool readCounters(std::vector<trace_counter_t>* counters);
+    bool readEnd();
+
+    std::FILE* m_file{nullptr};
+    std::string m_payload;
+    std::string m_stored;
+    // Events point to the names, so the names must not be moved
+    std::deque<std::string> m_strings;
+    std::string m_session_name;
+    uint64_t m_dropped_count{0};
+    bool m_completed{false};
+};
+
+} // namespace GE::Debug
+
+#endif // GE_DEBUG_BINARY_TRACE_READER_H_
@@ -0,0 +1,160 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "binary_trace_writer.h"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(GE_TRACE_LZ4)
+    #include <lz4.h>
+#endif
+
+namespace GE::Debug {
+
+void BinaryTraceWriter::writeHeader(const std::string& session_name)
+{
+    m_name_indexes.clear();
+    m_buffer.append(Trace::MAGIC, sizeof(Trace::MAGIC));
+    Trace::writeU32(&m_buffer, Trace::VERSION);
+
+    std::string payload;
+    Trace::writeVarint(&payload, session_name.size());
+    payload.append(session_name);
+    writeChunk(Trace::Chunk::SESSION, payload);
+}
+
+void BinaryTraceWriter::writeEvents(const std::vector<trace_event_t>& events)
+{
+    m_sorted_events = events;
+    std::stable_sort(m_sorted_events.begin(), m_sorted_events.end(),
+                     [](const auto& lhs, const auto& rhs) { return lhs.tid < rhs.tid; });
+
+    m_strings.clear();
+    m_events.clear();
+
+    for (auto block = m_sorted_events.begin(); block != m_sorted_events.end();) {
+        uint32_t tid = block->tid;
+        auto block_end =
+            std::find_if(block, m_sorted_events.end(),
+                         [tid](const auto& event) { return event.tid != tid; });
+        int64_t prev_start{0};
+
+        Trace::writeVarint(&m_events, tid);
+        Trace::writeVarint(&m_events, static_cast<uint64_t>(block_end - block));
+
+        for (; block != block_end; ++block) {
+            Trace::writeVarint(&m_events, getNameIndex(block->name));
+            Trace::writeVarint(&m_events, Trace::encodeZigzag(block->start - prev_start));
+            auto duration = static_cast<uint64_t>(block->end - block->start);
+            Trace::writeVarint(&m_events, duration);
+            prev_start = block->start;
+        }
+    }
+
+    if (!m_strings.empty()) {
+        writeChunk(Trace::Chunk::STRINGS, m_strings);
+    }
+
+    writeChunk(Trace::Chunk::EVENTS, m_events);
+}
+
+void BinaryTraceWriter::writeCounters(const std::vector<trace_counter_t>& counters)
+{
+    m_strings.clear();
+    m_events.clear();
+    int64_t prev_time{0};
+
+    Trace::writeVarint(&m_events, counters.size());
+
+    for (const auto& counter : counters) {
+        Trace::writeVarint(&m_events, getNameIndex(counter.name));
+        Trace::writeVarint(&m_events, Trace::encodeZigzag(counter.time - prev_time));
+        Trace::writeVarint(&m_events, Trace::encodeZigzag(counter.value));
+        prev_time = counter.time;
+    }
+
+    if (!m_strings.empty()) {
+        writeChunk(Trace::Chunk::STRINGS, m_strings);
+    }
+
+    writeChunk(Trace::Chunk::COUNTERS, m_events);
+}
+
+void BinaryTraceWriter::writeFooter(uint64_t dropped_count)
+{
+    std::string payload;
+    Trace::writeVarint(&payload, dropped_count);
+    writeChunk(Trace::Chunk::END, payload);
+}
+
+uint32_t BinaryTraceWriter::getNameIndex(const char* name)
+{
+    auto [it, inserted] =
+        m_name_indexes.emplace(name, static_cast<uint32_t>(m_name_indexes.size()));
+
+    if (inserted) {
+        size_t size = std::strlen(name);
+        Trace::writeVarint(&m_strings, size);
+        m_strings.append(name, size);
+    }
+
+    return it->second;
+}
+
+void BinaryTraceWriter::writeChunk(Trace::Chunk type, const std::string& payload)
+{
+    const std::string* stored = &payload;
+    auto compression = Trace::Compression::NONE;
+
+#if defined(GE_TRACE_LZ4)
+    auto payload_size = static_cast<int>(payload.size());
+    m_compressed.resize(LZ4_compressBound(payload_size));
+    int compressed_size = LZ4_compress_default(payload.data(), m_compressed.data(),
+                                               payload_size,
+                                               static_cast<int>(m_compressed.size()));
+
+    if (compressed_size > 0 && compressed_size < payload_size) {
+        m_compressed.resize(compressed_size);
+        stored = &m_compressed;
+        compression = Trace::Compression::LZ4;
+    }
+#endif
+
+    m_buffer.push_back(static_cast<char>(type));
+    m_buffer.push_back(static_cast<char>(compression));
+    Trace::writeU32(&m_buffer, static_cast<uint32_t>(payload.size()));
+    Trace::writeU32(&m_buffer, static_cast<uint32_t>(stored->size()));
+    m_buffer.append(*stored);
+}
+
+} // namespace GE::Debug
@@ -0,0 +1,66 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// NOLINTNEXTLINE
+#ifndef GE_DEBUG_BINARY_TRACE_WRITER_H_
+#define GE_DEBUG_BINARY_TRACE_WRITER_H_
+
+#include "trace_writer.h"
+
+#include <unordered_map>
+
+namespace GE::Debug {
+
+// Writes the format described in 'trace_format.h'. Chunks are compressed with
+// LZ4 if the engine is built with it
+class BinaryTraceWriter: public TraceWriter
+{
+protected:
+    void writeHeader(const std::string& session_name) override;
+    void writeEvents(const std::vector<trace_event_t>& events) override;
+    void writeCounters(const std::vector<trace_counter_t>& counters) override;
+    void writeFooter(uint64_t dropped_count) override;
+
+private:
+    uint32_t getNameIndex(const char* name);
+    void writeChunk(Trace::Chunk type, const std::string& payload);
+
+    std::unordered_map<const char*, uint32_t> m_name_indexes;
+    std::vector<trace_event_t> m_sorted_events;
+    std::string m_strings;
+    std::string m_events;
+    std::string m_compressed;
+};
+
+} // namespace GE::Debug
+
+#endif // GE_DEBUG_BINARY_TRACE_WRITER_H_
@@ -0,0 +1,209 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "counters.h"
+#include "profile.h"
+
+#include "ge/core/asserts.h"
+#include "ge/core/log.h"
+#include "ge/core/utils.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <deque>
+#include <mutex>
+
+namespace {
+
+using Counters = GE::Debug::Counters;
+using CounterValues = std::array<std::atomic<int64_t>, Counters::COUNTERS_MAX>;
+
+// Values only grow and are written by the owning thread only, so a plain
+// store is enough and the merge takes the difference from the previous frame
+struct thread_counters_t {
+    CounterValues values{};
+    std::array<int64_t, Counters::COUNTERS_MAX> merged{};
+};
+
+class Registry
+{
+public:
+    static Registry* get()
+    {
+        static Registry instance;
+        return &instance;
+    }
+
+    Counters::Id registerCounter(const std::string& name, Counters::Type type)
+    {
+        std::lock_guard lock{m_mtx};
+
+        for (Counters::Id id{0}; id < m_names.size(); id++) {
+            if (m_names[id] == name) {
+                GE_CORE_ASSERT_MSG(m_types[id] == type,
+                                   "Counter '{}' is registered with another type", name);
+                return id;
+            }
+        }
+
+        if (m_names.size() == Counters::COUNTERS_MAX) {
+            GE_CORE_ERR("Unable to register counter '{}': limit {} is reached", name,
+                        Counters::COUNTERS_MAX);
+            return Counters::INVALID_ID;
+        }
+
+        m_names.push_back(name);
+        m_types.push_back(type);
+        return static_cast<Counters::Id>(m_names.size() - 1);
+    }
+
+    void add(Counters::Id id, int64_t value)
+    {
+        // Shared with the registry, which removes the values once the thread has
+        // finished and they are merged
+        thread_local GE::Shared<thread_counters_t> counters;
+
+        if (counters == nullptr) {
+            counters = registerThread();
+        }
+
+        auto& counter = counters->values[id];
+        counter.store(counter.load(std::memory_order_relaxed) + value,
+                      std::memory_order_relaxed);
+    }
+
+    void set(Counters::Id id, int64_t value)
+    {
+        m_gauges[id].store(value, std::memory_order_relaxed);
+    }
+
+    void mergeFrame()
+    {
+        std::lock_guard lock{m_mtx};
+        auto count = static_cast<Counters::Id>(m_names.size());
+        m_frame_values.resize(count);
+
+        auto is_running = [](const auto& counters) { return counters.use_count() > 1; };
+        auto finished = std::partition(m_threads.begin(), m_threads.end(), is_running);
+
+        for (Counters::Id id{0}; id < count; id++) {
+            auto& frame_value = m_frame_values[id];
+            frame_value.name = m_names[id].c_str();
+            frame_value.type = m_types[id];
+
+            if (frame_value.type == Counters::Type::GAUGE) {
+                frame_value.value = m_gauges[id].load(std::memory_order_relaxed);
+                frame_value.total = frame_value.value;
+                continue;
+            }
+
+            frame_value.value = 0;
+
+            for (auto& counters : m_threads) {
+                int64_t value = counters->values[id].load(std::memory_order_relaxed);
+                frame_value.value += value - counters->merged[id];
+                counters->merged[id] = value;
+            }
+
+            frame_value.total += frame_value.value;
+        }
+
+        m_threads.erase(finished, m_threads.end());
+
+#ifdef GE_PROFILING
+        if (GE::Debug::Profiler::isRecording()) {
+            for (const auto& frame_value : m_frame_values) {
+                GE::Debug::Profiler::recordCounter(frame_value.name, frame_value.value);
+            }
+        }
+#endif
+    }
+
+    const std::vector<Counters::counter_t>& getFrameValues() const
+    {
+        return m_frame_values;
+    }
+
+private:
+    Registry() = default;
+
+    GE::Shared<thread_counters_t> registerThread()
+    {
+        std::lock_guard lock{m_mtx};
+        return m_threads.emplace_back(GE::makeShared<thread_counters_t>());
+    }
+
+    std::mutex m_mtx;
+    // Names are referred by the frame values and the profiler, so they must not
+    // be moved
+    std::deque<std::string> m_names;
+    std::vector<Counters::Type> m_types;
+    std::vector<GE::Shared<thread_counters_t>> m_threads;
+    CounterValues m_gauges{};
+    std::vector<Counters::counter_t> m_frame_values;
+};
+
+} // namespace
+
+namespace GE::Debug {
+
+Counters::Id Counters::registerCounter(const std::string& name, Type type)
+{
+    return Registry::get()->registerCounter(name, type);
+}
+
+void Counters::add(Id id, int64_t value)
+{
+    if (id < COUNTERS_MAX) {
+        Registry::get()->add(id, value);
+    }
+}
+
+void Counters::set(Id id, int64_t value)
+{
+    if (id < COUNTERS_MAX) {
+        Registry::get()->set(id, value);
+    }
+}
+
+void Counters::mergeFrame()
+{
+    Registry::get()->mergeFrame();
+}
+
+const std::vector<Counters::counter_t>& Counters::getFrameValues()
+{
+    return Registry::get()->getFrameValues();
+}
+
+} // namespace GE::Debug
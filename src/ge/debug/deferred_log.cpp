@@ -0,0 +1,314 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "deferred_log.h"
+
+#include "ge/core/bounded_queue.h"
+#include "ge/core/log.h"
+#include "ge/core/utils.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr std::chrono::milliseconds WRITER_SLEEP_PERIOD{5};
+
+using Record = GE::DeferredLog::record_t;
+
+struct thread_queue_t {
+    explicit thread_queue_t(size_t queue_size)
+        : records{queue_size}
+    {}
+
+    GE::BoundedQueue<Record> records;
+    // Is incremented only by the owner thread
+    std::atomic<uint64_t> pushed{0};
+    // Is incremented only by the writer
+    std::atomic<uint64_t> written{0};
+    uint64_t popped{0};
+};
+
+struct thread_state_t {
+    GE::Shared<thread_queue_t> queue;
+    uint64_t session{0};
+};
+
+class Writer
+{
+public:
+    static Writer* get()
+    {
+        static Writer instance;
+        return &instance;
+    }
+
+    bool start(size_t queue_size, bool drop_on_overflow)
+    {
+        std::lock_guard lock{m_mtx};
+
+        if (m_running) {
+            return false;
+        }
+
+        m_queue_size = queue_size;
+        m_drop_on_overflow = drop_on_overflow;
+        m_dropped = 0;
+        m_session++;
+        m_running = true;
+        m_writer = std::thread{[this] { writerThread(); }};
+        return true;
+    }
+
+    void stop()
+    {
+        {
+            std::lock_guard lock{m_mtx};
+
+            if (!m_running) {
+                return;
+            }
+
+            m_running = false;
+        }
+
+        m_wakeup.notify_one();
+        m_writer.join();
+
+        std::lock_guard lock{m_mtx};
+        m_queues.clear();
+    }
+
+    bool push(const Record& record)
+    {
+        thread_local thread_state_t state;
+        uint64_t session = m_session.load(std::memory_order_acquire);
+
+        if (state.session != session || state.queue == nullptr) {
+            std::lock_guard lock{m_mtx};
+
+            if (!m_running) {
+                return false;
+            }
+
+            state.queue = GE::makeShared<thread_queue_t>(m_queue_size);
+            state.session = session;
+            m_queues.push_back(state.queue);
+        }
+
+        auto& queue = *state.queue;
+
+        while (!queue.records.tryPush(Record{record})) {
+            if (m_drop_on_overflow) {
+                m_dropped.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+
+            if (!m_running) {
+                return false;
+            }
+
+            m_wakeup.notify_one();
+            std::this_thread::yield();
+        }
+
+        queue.pushed.store(queue.pushed.load(std::memory_order_relaxed) + 1,
+                           std::memory_order_release);
+        return true;
+    }
+
+    void flush()
+    {
+        std::vector<std::pair<GE::Shared<thread_queue_t>, uint64_t>> pushed;
+
+        {
+            std::lock_guard lock{m_mtx};
+
+            for (const auto& queue : m_queues) {
+                pushed.emplace_back(queue, queue->pushed.load(std::memory_order_acquire));
+            }
+        }
+
+        for (const auto& [queue, count] : pushed) {
+            while (m_running && queue->written.load(std::memory_order_acquire) < count) {
+                m_wakeup.notify_one();
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    uint64_t getDropped() const { return m_dropped.load(std::memory_order_relaxed); }
+
+private:
+    Writer() = default;
+    ~Writer() { stop(); }
+
+    void writerThread()
+    {
+        std::vector<GE::Shared<thread_queue_t>> queues;
+
+        while (true) {
+            bool is_running = m_running;
+            queues.clear();
+
+            {
+                std::lock_guard lock{m_mtx};
+                // Queues of finished threads are removed once they are drained
+                auto is_finished = [](const auto& queue) {
+                    return queue.use_count() == 1 && queue->records.isEmpty();
+                };
+                auto finished = std::remove_if(m_queues.begin(), m_queues.end(),
+                                               is_finished);
+                m_queues.erase(finished, m_queues.end());
+                queues = m_queues;
+            }
+
+            if (writeRecords(queues) == 0) {
+                if (!is_running) {
+                    break;
+                }
+
+                std::unique_lock lock{m_wakeup_mtx};
+                m_wakeup.wait_for(lock, WRITER_SLEEP_PERIOD);
+            }
+        }
+    }
+
+    size_t writeRecords(const std::vector<GE::Shared<thread_queue_t>>& queues)
+    {
+        m_records.clear();
+        Record record;
+
+        for (const auto& queue : queues) {
+            while (queue->records.tryPop(&record)) {
+                m_records.push_back(record);
+                queue->popped++;
+            }
+        }
+
+        // Records of different threads are merged by time
+        auto is_earlier = [](const auto& lhs, const auto& rhs) {
+            return lhs.time < rhs.time;
+        };
+        std::stable_sort(m_records.begin(), m_records.end(), is_earlier);
+
+        for (const auto& deferred : m_records) {
+            write(deferred);
+        }
+
+        for (const auto& queue : queues) {
+            queue->written.store(queue->popped, std::memory_order_release);
+        }
+
+        reportDropped();
+        return m_records.size();
+    }
+
+    void write(const Record& record)
+    {
+        m_buffer.clear();
+
+        try {
+            record.decode(record.getFormat(), record.getArgs(), &m_buffer);
+        } catch (const fmt::format_error& e) {
+            std::cerr << "Failed to format '" << record.getFormat() << "': " << e.what()
+                      << std::endl;
+            return;
+        }
+
+        record.logger->writeDeferred(record.time, record.level,
+                                     {m_buffer.data(), m_buffer.size()});
+    }
+
+    void reportDropped()
+    {
+        uint64_t dropped = m_dropped.load(std::memory_order_relaxed);
+
+        if (dropped != m_reported_dropped) {
+            GE_CORE_WARN("{} deferred log messages have been dropped",
+                         dropped - m_reported_dropped);
+            m_reported_dropped = dropped;
+        }
+    }
+
+    std::mutex m_mtx;
+    std::mutex m_wakeup_mtx;
+    std::condition_variable m_wakeup;
+    std::vector<GE::Shared<thread_queue_t>> m_queues;
+    std::thread m_writer;
+    std::atomic_bool m_running{false};
+    std::atomic<uint64_t> m_session{0};
+    size_t m_queue_size{};
+    bool m_drop_on_overflow{false};
+    std::atomic<uint64_t> m_dropped{0};
+    uint64_t m_reported_dropped{0};
+
+    std::vector<Record> m_records;
+    spdlog::memory_buf_t m_buffer;
+};
+
+} // namespace
+
+namespace GE {
+
+bool DeferredLog::initialize(size_t queue_size, bool drop_on_overflow)
+{
+    return Writer::get()->start(queue_size, drop_on_overflow);
+}
+
+void DeferredLog::shutdown()
+{
+    Writer::get()->stop();
+}
+
+void DeferredLog::flush()
+{
+    Writer::get()->flush();
+}
+
+uint64_t DeferredLog::getDroppedMessages()
+{
+    return Writer::get()->getDropped();
+}
+
+bool DeferredLog::push(const record_t& record)
+{
+    return Writer::get()->push(record);
+}
+
+} // namespace GE
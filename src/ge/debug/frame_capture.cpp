@@ -0,0 +1,126 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "frame_capture.h"
+#include "trace_writer.h"
+
+#include <algorithm>
+
+namespace {
+
+// Events are kept until the first frame is marked
+constexpr size_t PENDING_EVENTS_MAX{1 << 20};
+
+} // namespace
+
+namespace GE::Debug {
+
+FrameCapture::FrameCapture(uint32_t frames_count, int64_t frame_budget)
+    : m_frames_count{std::max(frames_count, 1u)}
+    , m_frame_budget{frame_budget}
+{}
+
+void FrameCapture::addFrame(int64_t start, int64_t end)
+{
+    std::vector<trace_event_t> events;
+
+    if (m_frames.size() == m_frames_count) {
+        events = std::move(m_frames.front().events);
+        events.clear();
+        m_frames.pop_front();
+    }
+
+    m_frames.push_back({start, end, std::move(events)});
+    m_frame_idx++;
+
+    if (m_spike_frame_idx > 0) {
+        m_frames_since_spike++;
+    } else if (end - start > m_frame_budget) {
+        m_spike_frame_idx = m_frame_idx;
+    }
+}
+
+void FrameCapture::addEvents(const std::vector<trace_event_t>& events)
+{
+    m_pending_events.insert(m_pending_events.end(), events.begin(), events.end());
+    assignPendingEvents();
+}
+
+void FrameCapture::dump(TraceWriter* writer)
+{
+    for (const auto& frame : m_frames) {
+        if (writer != nullptr) {
+            writer->write(frame.events);
+        }
+    }
+
+    m_frames.clear();
+    m_spike_frame_idx = 0;
+    m_frames_since_spike = 0;
+}
+
+void FrameCapture::assignPendingEvents()
+{
+    if (m_frames.empty()) {
+        if (m_pending_events.size() > PENDING_EVENTS_MAX) {
+            m_pending_events.clear();
+        }
+
+        return;
+    }
+
+    auto is_earlier = [](int64_t time, const trace_frame_t& frame) {
+        return time < frame.end;
+    };
+    size_t pending_count{0};
+
+    for (const auto& event : m_pending_events) {
+        // Events of the frames which have been evicted are dropped
+        if (event.start < m_frames.front().start) {
+            continue;
+        }
+
+        auto frame =
+            std::upper_bound(m_frames.begin(), m_frames.end(), event.start, is_earlier);
+
+        if (frame == m_frames.end()) {
+            m_pending_events[pending_count++] = event;
+            continue;
+        }
+
+        frame->events.push_back(event);
+    }
+
+    m_pending_events.resize(pending_count);
+}
+
+} // namespace GE::Debug
@@ -0,0 +1,79 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// NOLINTNEXTLINE
+#ifndef GE_DEBUG_FRAME_CAPTURE_H_
+#define GE_DEBUG_FRAME_CAPTURE_H_
+
+#include "trace_format.h"
+
+#include <deque>
+#include <vector>
+
+namespace GE::Debug {
+
+class TraceWriter;
+
+// Keeps events of the last frames. When a frame exceeds the budget, the capture
+// waits for one more frame to receive the late events of other threads and
+// then it's ready to be dumped. Events are assigned to the frame which they
+// start in, so scopes wider than a frame belong to the one they have begun in.
+class FrameCapture
+{
+public:
+    FrameCapture(uint32_t frames_count, int64_t frame_budget);
+
+    void addFrame(int64_t start, int64_t end);
+    void addEvents(const std::vector<trace_event_t>& events);
+
+    bool isDumpReady() const { return m_spike_frame_idx > 0 && m_frames_since_spike > 0; }
+    uint64_t getSpikeFrameIdx() const { return m_spike_frame_idx; }
+    const std::deque<trace_frame_t>& getFrames() const { return m_frames; }
+
+    // Writes the kept frames if 'writer' is set and starts capturing from scratch
+    void dump(TraceWriter* writer);
+
+private:
+    void assignPendingEvents();
+
+    uint32_t m_frames_count{};
+    int64_t m_frame_budget{};
+    std::deque<trace_frame_t> m_frames;
+    std::vector<trace_event_t> m_pending_events;
+    uint64_t m_frame_idx{0};
+    uint64_t m_spike_frame_idx{0};
+    uint32_t m_frames_since_spike{0};
+};
+
+} // namespace GE::Debug
+
+#endif // GE_DEBUG_FRAME_CAPTURE_H_
@@ -0,0 +1,96 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "json_trace_writer.h"
+
+#include <spdlog/fmt/fmt.h>
+
+#include <iterator>
+
+namespace {
+
+constexpr double NS_IN_US{1e3};
+
+} // namespace
+
+namespace GE::Debug {
+
+void JsonTraceWriter::writeHeader(const std::string& session_name)
+{
+    m_session_name = session_name;
+    fmt::format_to(std::back_inserter(m_buffer),
+                   R"({{"traceEvents":[{{}})"
+                   "\n"
+                   R"(,{{"name":"thread_name","ph":"M","pid":0,"tid":{},)"
+                   R"("args":{{"name":"GPU"}}}})"
+                   "\n",
+                   TRACE_GPU_TID);
+}
+
+void JsonTraceWriter::writeEvents(const std::vector<trace_event_t>& events)
+{
+    auto out = std::back_inserter(m_buffer);
+
+    for (const auto& event : events) {
+        fmt::format_to(out,
+                       R"(,{{"cat":"function","dur":{:.3f},"name":"{}","ph":"X",)"
+                       R"("pid":0,"tid":{},"ts":{:.3f}}})"
+                       "\n",
+                       static_cast<double>(event.end - event.start) / NS_IN_US,
+                       event.name, event.tid,
+                       static_cast<double>(event.start) / NS_IN_US);
+    }
+}
+
+void JsonTraceWriter::writeCounters(const std::vector<trace_counter_t>& counters)
+{
+    auto out = std::back_inserter(m_buffer);
+
+    for (const auto& counter : counters) {
+        fmt::format_to(out,
+                       R"(,{{"name":"{}","ph":"C","pid":0,"ts":{:.3f},)"
+                       R"("args":{{"value":{}}}}})"
+                       "\n",
+                       counter.name, static_cast<double>(counter.time) / NS_IN_US,
+                       counter.value);
+    }
+}
+
+void JsonTraceWriter::writeFooter(uint64_t dropped_count)
+{
+    fmt::format_to(std::back_inserter(m_buffer),
+                   R"(],"otherData":{{"session":"{}","dropped_events":{}}}}})"
+                   "\n",
+                   m_session_name, dropped_count);
+}
+
+} // namespace GE::Debug
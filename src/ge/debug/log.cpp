@@ -31,11 +31,13 @@
  */
 
 #include "log.h"
+#include "async_sink.h"
 
 #include "ge/core/asserts.h"
 #include "ge/core/utils.h"
 #include "ge/debug/profile.h"
 
+#include <spdlog/sinks/rotating_file_sink.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 
 #include <iostream>
@@ -52,6 +54,9 @@
 #define LOGLVL_CRIT_STR  "Critical"
 #define LOGLVL_NONE_STR  "None"
 
+#define OVERFLOW_POLICY_BLOCK_STR "Block"
+#define OVERFLOW_POLICY_DROP_STR  "Drop"
+
 using SpdlogLevel = spdlog::level::level_enum;
 
 namespace {
@@ -73,10 +78,34 @@ SpdlogLevel toSpdlogLvl(GE::Logger::Level level)
     return SpdlogLevel::critical;
 }
 
+bool createSinks(const GE::Log::properties_t& props, std::vector<spdlog::sink_ptr>* sinks)
+{
+    try {
+        sinks->push_back(std::make_shared<spdlog::sinks::stdout_color_sink_mt>());
+
+        if (!props.file.empty()) {
+            sinks->push_back(std::make_shared<spdlog::sinks::rotating_file_sink_mt>(
+                props.file, props.file_size_max, props.files_count));
+        }
+    } catch (const spdlog::spdlog_ex& e) {
+        std::cerr << "Failed to create log sinks: " << e.what() << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
 } // namespace
 
 namespace GE {
 
+Logger::Logger()
+{
+    for (auto& level : m_category_levels) {
+        level.store(GE_LOGLVL_TRACE, std::memory_order_relaxed);
+    }
+}
+
 Logger::~Logger()
 {
     if (m_logger) {
@@ -84,12 +113,14 @@ Logger::~Logger()
     }
 }
 
-bool Logger::initialize(const std::string& name)
+bool Logger::initialize(const std::string& name,
+                        const std::vector<spdlog::sink_ptr>& sinks)
 {
     GE_PROFILE_FUNC();
 
     try {
-        m_logger = spdlog::stdout_color_mt(name);
+        m_logger = std::make_shared<spdlog::logger>(name, sinks.begin(), sinks.end());
+        spdlog::register_logger(m_logger);
     } catch (const spdlog::spdlog_ex& e) {
         std::cerr << "Failed to create logger '" << name << "': " << e.what()
                   << std::endl;
@@ -111,28 +142,85 @@ void Logger::shutdown()
     m_logger_name.clear();
 }
 
+void Logger::writeDeferred(spdlog::log_clock::time_point time,
+                           spdlog::level::level_enum level, spdlog::string_view_t message)
+{
+    if (!m_logger) {
+        return;
+    }
+
+    spdlog::details::log_msg msg{time, spdlog::source_loc{}, m_logger_name, level,
+                                 message};
+
+    for (auto& sink : m_logger->sinks()) {
+        if (!sink->should_log(level)) {
+            continue;
+        }
+
+        try {
+            sink->log(msg);
+        } catch (const spdlog::spdlog_ex& e) {
+            std::cerr << "Failed to write log message: " << e.what() << std::endl;
+        }
+    }
+}
+
 void Logger::setLevel(Level level)
 {
     GE_PROFILE_FUNC();
 
     m_level = level;
     m_logger->set_level(toSpdlogLvl(level));
-    m_level = level;
+}
+
+void Logger::setCategoryLevel(LogCategory category, Level level)
+{
+    GE_PROFILE_FUNC();
+
+    m_category_levels[toIndex(category)].store(level, std::memory_order_relaxed);
 }
 
 bool Log::initialize()
+{
+    return initialize(properties_t{});
+}
+
+bool Log::initialize(const properties_t& props)
 {
     GE_PROFILE_FUNC();
 
     auto& core_logger = get()->m_core_logger;
     auto& client_logger = get()->m_client_logger;
+    std::vector<spdlog::sink_ptr> sinks;
+
+    if (!createSinks(props, &sinks)) {
+        return false;
+    }
+
+    if (props.async) {
+        get()->m_async_sink = makeShared<AsyncSink>(std::move(sinks), props.queue_size,
+                                                    props.overflow_policy);
+        sinks = {get()->m_async_sink};
+    }
 
-    if (!core_logger.initialize(CORE_LOGGER_NAME) ||
-        !client_logger.initialize(CLIENT_LOGGER_NAME)) {
+    if (!core_logger.initialize(CORE_LOGGER_NAME, sinks) ||
+        !client_logger.initialize(CLIENT_LOGGER_NAME, sinks)) {
         shutdown();
         return false;
     }
 
+    if (props.deferred &&
+        !DeferredLog::initialize(props.queue_size,
+                                 props.overflow_policy == OverflowPolicy::DROP)) {
+        std::cerr << "Failed to initialize deferred log" << std::endl;
+        shutdown();
+        return false;
+    }
+
+    core_logger.setDeferred(props.deferred);
+    client_logger.setDeferred(props.deferred);
+    get()->m_props = props;
+
     core_logger.setLevel(GE_LOGLVL_TRACE);
     client_logger.setLevel(GE_LOGLVL_TRACE);
 
@@ -145,13 +233,36 @@ void Log::shutdown()
     GE_PROFILE_FUNC();
 
     GE_CORE_DBG("Shutdown log system");
+    flush();
+    DeferredLog::shutdown();
+    get()->m_client_logger.setDeferred(false);
+    get()->m_core_logger.setDeferred(false);
     get()->m_client_logger.shutdown();
     get()->m_core_logger.shutdown();
+    get()->m_async_sink.reset();
+}
+
+void Log::flush()
+{
+    GE_PROFILE_FUNC();
+
+    DeferredLog::flush();
+
+    for (auto* logger : {core(), client()}) {
+        logger->flush();
+    }
+}
+
+uint64_t Log::getDroppedMessages()
+{
+    const auto& async_sink = get()->m_async_sink;
+    uint64_t dropped = get()->m_props.deferred ? DeferredLog::getDroppedMessages() : 0;
+    return dropped + (async_sink ? async_sink->getDroppedMessages() : 0);
 }
 
 std::string toString(Logger::Level level)
 {
-    std::unordered_map<Logger::Level, std::string> lvl_to_str{
+    static const std::unordered_map<Logger::Level, std::string> lvl_to_str{
         {GE_LOGLVL_TRACE, LOGLVL_TRACE_STR}, {GE_LOGLVL_DBG, LOGLVL_DBG_STR},
         {GE_LOGLVL_INFO, LOGLVL_INFO_STR},   {GE_LOGLVL_WARN, LOGLVL_WARN_STR},
         {GE_LOGLVL_ERR, LOGLVL_ERR_STR},     {GE_LOGLVL_CRIT, LOGLVL_CRIT_STR},
@@ -162,7 +273,7 @@ std::string toString(Logger::Level level)
 
 Logger::Level toLogLvl(const std::string& level)
 {
-    std::unordered_map<std::string, Logger::Level> str_to_lvl{
+    static const std::unordered_map<std::string, Logger::Level> str_to_lvl{
         {LOGLVL_TRACE_STR, GE_LOGLVL_TRACE}, {LOGLVL_DBG_STR, GE_LOGLVL_DBG},
         {LOGLVL_INFO_STR, GE_LOGLVL_INFO},   {LOGLVL_WARN_STR, GE_LOGLVL_WARN},
         {LOGLVL_ERR_STR, GE_LOGLVL_ERR},     {LOGLVL_CRIT_STR, GE_LOGLVL_CRIT}};
@@ -170,4 +281,19 @@ Logger::Level toLogLvl(const std::string& level)
     return toType(str_to_lvl, level, GE_LOGLVL_NONE);
 }
 
+std::string toString(Log::OverflowPolicy policy)
+{
+    switch (policy) {
+        case Log::OverflowPolicy::BLOCK: return OVERFLOW_POLICY_BLOCK_STR;
+        case Log::OverflowPolicy::DROP: return OVERFLOW_POLICY_DROP_STR;
+        default: return {};
+    }
+}
+
+Log::OverflowPolicy toOverflowPolicy(const std::string& policy)
+{
+    return policy == OVERFLOW_POLICY_DROP_STR ? Log::OverflowPolicy::DROP
+                                              : Log::OverflowPolicy::BLOCK;
+}
+
 } // namespace GE
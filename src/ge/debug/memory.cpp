@@ -0,0 +1,364 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "memory.h"
+#include "counters.h"
+
+#include "ge/core/log.h"
+
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+namespace {
+
+using GE::Debug::Counters;
+using GE::Debug::MemoryTag;
+
+constexpr size_t MEMORY_TAGS_COUNT{static_cast<size_t>(MemoryTag::COUNT)};
+constexpr size_t MEMORY_HOT_PATHS_MAX{64};
+
+// Precedes every tracked block, the size keeps the alignment of 'malloc()'
+struct alignas(std::max_align_t) header_t {
+    uint64_t size{};
+    MemoryTag tag{MemoryTag::UNTAGGED};
+};
+
+struct tag_stats_t {
+    std::atomic<uint64_t> bytes{0};
+    std::atomic<uint64_t> allocations{0};
+    std::atomic<uint64_t> frame_allocations{0};
+    std::atomic<uint64_t> frame_bytes{0};
+    std::atomic<uint64_t> budget{0};
+    // Values of the last merged frame
+    std::atomic<uint64_t> last_frame_allocations{0};
+    std::atomic<uint64_t> last_frame_bytes{0};
+};
+
+struct hot_path_t {
+    std::atomic<const char*> name{nullptr};
+    std::atomic<uint64_t> allocations{0};
+};
+
+// The global operator new may be called before dynamic initialization, so
+// everything here is constant-initialized
+thread_local MemoryTag t_tag{MemoryTag::UNTAGGED};
+thread_local const char* t_hot_path{nullptr};
+
+class Tracker
+{
+public:
+    static Tracker* get()
+    {
+        static Tracker instance;
+        return &instance;
+    }
+
+    void* allocate(size_t size, MemoryTag tag)
+    {
+        auto* header = static_cast<header_t*>(std::malloc(sizeof(header_t) + size));
+
+        if (header == nullptr) {
+            return nullptr;
+        }
+
+        header->size = size;
+        header->tag = tag;
+
+        auto& stats = m_tags[static_cast<size_t>(tag)];
+        stats.bytes.fetch_add(size, std::memory_order_relaxed);
+        stats.allocations.fetch_add(1, std::memory_order_relaxed);
+        stats.frame_allocations.fetch_add(1, std::memory_order_relaxed);
+        stats.frame_bytes.fetch_add(size, std::memory_order_relaxed);
+
+        if (t_hot_path != nullptr) {
+            addHotPathAllocation(t_hot_path);
+        }
+
+        return header + 1;
+    }
+
+    void deallocate(void* ptr)
+    {
+        if (ptr == nullptr) {
+            return;
+        }
+
+        auto* header = static_cast<header_t*>(ptr) - 1;
+        auto& stats = m_tags[static_cast<size_t>(header->tag)];
+        stats.bytes.fetch_sub(header->size, std::memory_order_relaxed);
+        stats.allocations.fetch_sub(1, std::memory_order_relaxed);
+        std::free(header);
+    }
+
+    void setBudget(MemoryTag tag, uint64_t bytes)
+    {
+        m_tags[static_cast<size_t>(tag)].budget = bytes;
+    }
+
+    GE::Debug::Memory::stats_t getStats(MemoryTag tag) const
+    {
+        const auto& stats = m_tags[static_cast<size_t>(tag)];
+        return {stats.bytes.load(std::memory_order_relaxed),
+                stats.allocations.load(std::memory_order_relaxed),
+                stats.last_frame_allocations.load(std::memory_order_relaxed),
+                stats.last_frame_bytes.load(std::memory_order_relaxed),
+                stats.budget.load(std::memory_order_relaxed)};
+    }
+
+    uint64_t getHotPathAllocations() const { return m_hot_path_allocations; }
+
+    void mergeFrame()
+    {
+        if (!m_counters_registered) {
+            registerCounters();
+        }
+
+        for (size_t i{0}; i < MEMORY_TAGS_COUNT; i++) {
+            auto& stats = m_tags[i];
+            uint64_t frame_allocations = stats.frame_allocations.exchange(0);
+            uint64_t bytes = stats.bytes.load(std::memory_order_relaxed);
+            uint64_t budget = stats.budget.load(std::memory_order_relaxed);
+            bool is_over_budget = budget > 0 && bytes > budget;
+
+            stats.last_frame_allocations = frame_allocations;
+            stats.last_frame_bytes = stats.frame_bytes.exchange(0);
+
+            if (is_over_budget && !m_over_budget[i]) {
+                GE_CORE_WARN("Memory of '{}' is over budget: {} > {} bytes",
+                             GE::Debug::toString(static_cast<MemoryTag>(i)), bytes,
+                             budget);
+            }
+
+            m_over_budget[i] = is_over_budget;
+            Counters::set(m_bytes_counters[i], static_cast<int64_t>(bytes));
+            Counters::set(m_allocations_counters[i],
+                          static_cast<int64_t>(frame_allocations));
+        }
+
+        mergeHotPaths();
+    }
+
+private:
+    constexpr Tracker() = default;
+
+    void addHotPathAllocation(const char* name)
+    {
+        for (auto& hot_path : m_hot_paths) {
+            const char* hot_path_name = hot_path.name.load(std::memory_order_acquire);
+
+            if (hot_path_name == nullptr &&
+                hot_path.name.compare_exchange_strong(hot_path_name, name)) {
+                hot_path_name = name;
+            }
+
+            if (hot_path_name == name) {
+                hot_path.allocations.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+        }
+    }
+
+    void mergeHotPaths()
+    {
+        uint64_t frame_allocations{0};
+
+        for (size_t i{0}; i < MEMORY_HOT_PATHS_MAX; i++) {
+            const char* name = m_hot_paths[i].name.load(std::memory_order_acquire);
+
+            if (name == nullptr) {
+                break;
+            }
+
+            uint64_t allocations = m_hot_paths[i].allocations.exchange(0);
+            frame_allocations += allocations;
+
+            if (allocations > 0 && !m_hot_path_reported[i]) {
+                GE_CORE_WARN("Hot path '{}' allocates memory: {} allocations per frame",
+                             name, allocations);
+                m_hot_path_reported[i] = true;
+            }
+        }
+
+        m_hot_path_allocations = frame_allocations;
+        Counters::set(m_hot_path_counter, static_cast<int64_t>(frame_allocations));
+    }
+
+    void registerCounters()
+    {
+        for (size_t i{0}; i < MEMORY_TAGS_COUNT; i++) {
+            std::string tag_name{GE::Debug::toString(static_cast<MemoryTag>(i))};
+            m_bytes_counters[i] = Counters::registerCounter("Memory: " + tag_name + ", B",
+                                                            Counters::Type::GAUGE);
+            m_allocations_counters[i] = Counters::registerCounter(
+                "Allocations: " + tag_name, Counters::Type::GAUGE);
+        }
+
+        m_hot_path_counter =
+            Counters::registerCounter("Allocations: hot paths", Counters::Type::GAUGE);
+        m_counters_registered = true;
+    }
+
+    std::array<tag_stats_t, MEMORY_TAGS_COUNT> m_tags{};
+    std::array<hot_path_t, MEMORY_HOT_PATHS_MAX> m_hot_paths{};
+    std::atomic<uint64_t> m_hot_path_allocations{0};
+
+    // Used by the main loop thread only
+    std::array<bool, MEMORY_TAGS_COUNT> m_over_budget{};
+    std::array<bool, MEMORY_HOT_PATHS_MAX> m_hot_path_reported{};
+    std::array<Counters::Id, MEMORY_TAGS_COUNT> m_bytes_counters{};
+    std::array<Counters::Id, MEMORY_TAGS_COUNT> m_allocations_counters{};
+    Counters::Id m_hot_path_counter{Counters::INVALID_ID};
+    bool m_counters_registered{false};
+};
+
+} // namespace
+
+namespace GE::Debug {
+
+const char* toString(MemoryTag tag)
+{
+    switch (tag) {
+        case MemoryTag::UNTAGGED: return "Untagged";
+        case MemoryTag::RENDERER: return "Renderer";
+        case MemoryTag::TEXTURES: return "Textures";
+        case MemoryTag::ECS: return "ECS";
+        case MemoryTag::GUI: return "GUI";
+        case MemoryTag::EVENTS: return "Events";
+        case MemoryTag::FRAME_ARENA: return "Frame arena";
+        default: return "Unknown";
+    }
+}
+
+void* Memory::allocate(size_t size, MemoryTag tag)
+{
+    void* ptr = Tracker::get()->allocate(size, tag);
+
+    if (ptr == nullptr) {
+        throw std::bad_alloc{};
+    }
+
+    return ptr;
+}
+
+void Memory::deallocate(void* ptr)
+{
+    Tracker::get()->deallocate(ptr);
+}
+
+void Memory::setBudget(MemoryTag tag, uint64_t bytes)
+{
+    Tracker::get()->setBudget(tag, bytes);
+}
+
+Memory::stats_t Memory::getStats(MemoryTag tag)
+{
+    return Tracker::get()->getStats(tag);
+}
+
+uint64_t Memory::getHotPathAllocations()
+{
+    return Tracker::get()->getHotPathAllocations();
+}
+
+void Memory::mergeFrame()
+{
+    Tracker::get()->mergeFrame();
+}
+
+MemoryTagScope::MemoryTagScope(MemoryTag tag)
+    : m_prev_tag{t_tag}
+{
+    t_tag = tag;
+}
+
+MemoryTagScope::~MemoryTagScope()
+{
+    t_tag = m_prev_tag;
+}
+
+MemoryHotPathScope::MemoryHotPathScope(const char* name)
+    : m_prev_name{t_hot_path}
+{
+    t_hot_path = name;
+}
+
+MemoryHotPathScope::~MemoryHotPathScope()
+{
+    t_hot_path = m_prev_name;
+}
+
+} // namespace GE::Debug
+
+#ifdef GE_MEMORY_TRACKING
+void* operator new(size_t size)
+{
+    return GE::Debug::Memory::allocate(size, t_tag);
+}
+
+void* operator new[](size_t size)
+{
+    return GE::Debug::Memory::allocate(size, t_tag);
+}
+
+void* operator new(size_t size, const std::nothrow_t& /*tag*/) noexcept
+{
+    return Tracker::get()->allocate(size, t_tag);
+}
+
+void* operator new[](size_t size, const std::nothrow_t& /*tag*/) noexcept
+{
+    return Tracker::get()->allocate(size, t_tag);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    Tracker::get()->deallocate(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    Tracker::get()->deallocate(ptr);
+}
+
+void operator delete(void* ptr, size_t /*size*/) noexcept
+{
+    Tracker::get()->deallocate(ptr);
+}
+
+void operator delete[](void* ptr, size_t /*size*/) noexcept
+{
+    Tracker::get()->deallocate(ptr);
+}
+#endif // GE_MEMORY_TRACKING
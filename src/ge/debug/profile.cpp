@@ -0,0 +1,505 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "profile.h"
+
+#ifdef GE_PROFILING
+    #include "frame_capture.h"
+    #include "spsc_ring.h"
+    #include "trace_writer.h"
+
+    #include "ge/core/utils.h"
+
+    #include <algorithm>
+    #include <condition_variable>
+    #include <filesystem>
+    #include <limits>
+    #include <mutex>
+    #include <thread>
+    #include <vector>
+
+namespace {
+
+constexpr size_t PROFILER_RING_CAPACITY{16384};
+constexpr std::chrono::milliseconds PROFILER_DRAIN_PERIOD{10};
+constexpr std::chrono::milliseconds PROFILER_CALIBRATION_PERIOD{1};
+constexpr auto PROFILER_FRAME_NAME = "Frame";
+
+using Event = GE::Debug::Profiler::event_t;
+using EventRing = GE::Debug::SpscRing<Event, PROFILER_RING_CAPACITY>;
+
+int64_t steadyNow()
+{
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+}
+
+struct thread_buffer_t {
+    EventRing ring;
+    uint32_t thread_idx{};
+};
+
+// Shares the buffer with the collector, which removes it once the thread has
+// finished and the buffer is drained
+struct thread_buffer_owner_t {
+    GE::Shared<thread_buffer_t> buffer;
+};
+
+class Collector
+{
+public:
+    ~Collector()
+    {
+        end();
+        setLiveFramesCount(0);
+    }
+
+    static Collector* get()
+    {
+        static Collector instance;
+        return &instance;
+    }
+
+    void enable(bool enabled)
+    {
+        std::lock_guard lock{m_session_mtx};
+        m_enabled = enabled;
+        m_recording = m_enabled && isActive();
+    }
+
+    bool isEnabled() const { return m_enabled; }
+    bool isRecording() const { return m_recording.load(std::memory_order_relaxed); }
+
+    void begin(const std::string& name, const std::string& filepath)
+    {
+        std::lock_guard lock{m_session_mtx};
+        GE_CORE_ASSERT_MSG(!isSessionOpen(),
+                           "Begin profiling '{}' when '{}' already open", name,
+                           m_session_name);
+
+        auto writer = GE::Debug::TraceWriter::create(filepath);
+
+        if (!writer->open(filepath, name)) {
+            return;
+        }
+
+        stopLiveCollector();
+        m_writer = std::move(writer);
+        startSession(name);
+    }
+
+    void beginCapture(const std::string& name, const std::string& filepath,
+                      uint32_t frames_count, GE::Timestamp frame_budget)
+    {
+        std::lock_guard lock{m_session_mtx};
+        GE_CORE_ASSERT_MSG(!isSessionOpen(),
+                           "Begin capture '{}' when '{}' already open", name,
+                           m_session_name);
+
+        auto budget_ns = static_cast<int64_t>(frame_budget.ns());
+        stopLiveCollector();
+        m_capture = GE::makeScoped<GE::Debug::FrameCapture>(frames_count, budget_ns);
+        m_capture_filepath = filepath;
+        startSession(name);
+    }
+
+    void end()
+    {
+        std::lock_guard lock{m_session_mtx};
+
+        if (!isSessionOpen()) {
+            return;
+        }
+
+        m_recording = false;
+        stopCollector();
+
+        if (m_writer != nullptr) {
+            m_writer->close(m_dropped_count);
+            m_writer.reset();
+        }
+
+        if (m_capture != nullptr) {
+            if (m_capture->getSpikeFrameIdx() > 0) {
+                dumpCapture();
+            }
+
+            m_capture.reset();
+        }
+
+        if (m_live != nullptr) {
+            startCollector();
+        }
+    }
+
+    void setLiveFramesCount(uint32_t frames_count)
+    {
+        std::lock_guard lock{m_session_mtx};
+        stopLiveCollector();
+
+        {
+            std::lock_guard live_lock{m_live_mtx};
+            m_live.reset();
+
+            if (frames_count > 0) {
+                m_live = GE::makeScoped<GE::Debug::FrameCapture>(
+                    frames_count, std::numeric_limits<int64_t>::max());
+            }
+        }
+
+        if (isActive()) {
+            startCollector();
+        }
+    }
+
+    void readLiveFrames(const GE::Debug::Profiler::FrameReader& reader)
+    {
+        std::lock_guard lock{m_live_mtx};
+
+        if (m_live != nullptr) {
+            reader(m_live->getFrames());
+        }
+    }
+
+    // Is called from the main loop thread only
+    void markFrame()
+    {
+        int64_t now = GE::Debug::Profiler::now();
+        bool recording = isRecording();
+
+        if (recording && m_frame_start != 0) {
+            record(PROFILER_FRAME_NAME, m_frame_start, now,
+                   GE::Debug::Profiler::Track::FRAME);
+        }
+
+        m_frame_start = recording ? now : 0;
+    }
+
+    void record(const char* name, int64_t start, int64_t end,
+                GE::Debug::Profiler::Track track)
+    {
+        thread_local thread_buffer_owner_t owner;
+
+        if (owner.buffer == nullptr) {
+            owner.buffer = registerThread();
+        }
+
+        auto& buffer = owner.buffer;
+
+        if (!buffer->ring.push({name, start, end, buffer->thread_idx, track})) {
+            m_dropped_count.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    uint64_t getDroppedCount() const { return m_dropped_count; }
+
+private:
+    Collector() = default;
+
+    bool isSessionOpen() const { return m_writer != nullptr || m_capture != nullptr; }
+    bool isActive() const { return isSessionOpen() || m_live != nullptr; }
+
+    void startSession(const std::string& name)
+    {
+        m_session_name = name;
+        m_dropped_count = 0;
+        startCollector();
+    }
+
+    // Live frames are flushed before a session is switched, so the session
+    // doesn't get the events recorded before it has begun
+    void stopLiveCollector()
+    {
+        if (m_collector.joinable()) {
+            stopCollector();
+        }
+    }
+
+    void startCollector()
+    {
+        // Events left from a previous run are discarded
+        drain();
+        m_events.clear();
+
+        m_base_ticks = GE::Debug::Profiler::now();
+        m_base_ns = steadyNow();
+        std::this_thread::sleep_for(PROFILER_CALIBRATION_PERIOD);
+        calibrate();
+
+        m_stop_collector = false;
+        m_collector = std::thread{&Collector::collectorThread, this};
+        m_recording = m_enabled.load();
+    }
+
+    void stopCollector()
+    {
+        {
+            std::lock_guard lock{m_collector_mtx};
+            m_stop_collector = true;
+        }
+
+        m_collector_condition.notify_one();
+        m_collector.join();
+
+        drain();
+        writeEvents();
+    }
+
+    GE::Shared<thread_buffer_t> registerThread()
+    {
+        std::lock_guard lock{m_buffers_mtx};
+        auto& buffer = m_buffers.emplace_back(GE::makeShared<thread_buffer_t>());
+        buffer->thread_idx = ++m_threads_count;
+        return buffer;
+    }
+
+    void collectorThread()
+    {
+        std::unique_lock lock{m_collector_mtx};
+
+        while (!m_stop_collector) {
+            m_collector_condition.wait_for(lock, PROFILER_DRAIN_PERIOD,
+                                           [this] { return m_stop_collector; });
+            lock.unlock();
+            drain();
+            writeEvents();
+            lock.lock();
+        }
+    }
+
+    void drain()
+    {
+        std::lock_guard lock{m_buffers_mtx};
+
+        // Buffers of finished threads are removed once they are drained
+        auto drain_buffer = [this](const auto& buffer) {
+            bool is_finished = buffer.use_count() == 1;
+            buffer->ring.popAll(&m_events);
+            return is_finished;
+        };
+        auto finished = std::remove_if(m_buffers.begin(), m_buffers.end(), drain_buffer);
+        m_buffers.erase(finished, m_buffers.end());
+    }
+
+    // The ratio is refined over the whole session, so the error of the initial
+    // calibration doesn't accumulate
+    void calibrate()
+    {
+        int64_t ticks = GE::Debug::Profiler::now() - m_base_ticks;
+        int64_t ns = steadyNow() - m_base_ns;
+
+        if (ticks > 0) {
+            m_ns_per_tick = static_cast<double>(ns) / static_cast<double>(ticks);
+        }
+    }
+
+    int64_t toNs(const Event& event, int64_t time) const
+    {
+        if (event.track == GE::Debug::Profiler::Track::GPU) {
+            return time;
+        }
+
+        double ns = static_cast<double>(time - m_base_ticks) * m_ns_per_tick;
+        return m_base_ns + static_cast<int64_t>(ns);
+    }
+
+    void writeEvents()
+    {
+        calibrate();
+        m_trace_events.clear();
+        m_trace_counters.clear();
+
+        for (const auto& event : m_events) {
+            if (event.track == GE::Debug::Profiler::Track::COUNTER) {
+                int64_t time = toNs(event, event.start);
+                m_trace_counters.push_back({event.name, time, event.end});
+                continue;
+            }
+
+            uint32_t tid = event.track == GE::Debug::Profiler::Track::GPU
+                               ? GE::Debug::TRACE_GPU_TID
+                               : event.thread_idx;
+            int64_t start = toNs(event, event.start);
+            int64_t end = toNs(event, event.end);
+            m_trace_events.push_back({event.name, start, end, tid});
+
+            bool is_frame = event.track == GE::Debug::Profiler::Track::FRAME;
+
+            if (is_frame && m_capture != nullptr) {
+                m_capture->addFrame(start, end);
+            }
+
+            if (is_frame && m_live != nullptr) {
+                std::lock_guard lock{m_live_mtx};
+                m_live->addFrame(start, end);
+            }
+        }
+
+        m_events.clear();
+
+        if (m_writer != nullptr) {
+            m_writer->write(m_trace_events);
+            m_writer->write(m_trace_counters);
+        }
+
+        if (m_live != nullptr) {
+            std::lock_guard lock{m_live_mtx};
+            m_live->addEvents(m_trace_events);
+        }
+
+        if (m_capture != nullptr) {
+            m_capture->addEvents(m_trace_events);
+
+            if (m_capture->isDumpReady()) {
+                dumpCapture();
+            }
+        }
+    }
+
+    void dumpCapture()
+    {
+        std::filesystem::path filepath{m_capture_filepath};
+        std::string frame_idx = std::to_string(m_capture->getSpikeFrameIdx());
+        filepath.replace_filename(filepath.stem().string() + "_" + frame_idx +
+                                  filepath.extension().string());
+
+        auto writer = GE::Debug::TraceWriter::create(filepath.string());
+
+        if (writer->open(filepath.string(), m_session_name)) {
+            m_capture->dump(writer.get());
+            writer->close(m_dropped_count);
+        } else {
+            m_capture->dump(nullptr);
+        }
+    }
+
+    std::atomic_bool m_enabled{false};
+    std::atomic_bool m_recording{false};
+    std::atomic<uint64_t> m_dropped_count{0};
+
+    std::mutex m_session_mtx;
+    std::string m_session_name;
+    GE::Scoped<GE::Debug::TraceWriter> m_writer;
+    GE::Scoped<GE::Debug::FrameCapture> m_capture;
+    std::string m_capture_filepath;
+    GE::Scoped<GE::Debug::FrameCapture> m_live;
+    std::mutex m_live_mtx;
+    int64_t m_frame_start{0};
+    int64_t m_base_ticks{};
+    int64_t m_base_ns{};
+    double m_ns_per_tick{1.0};
+    std::vector<Event> m_events;
+    std::vector<GE::Debug::trace_event_t> m_trace_events;
+    std::vector<GE::Debug::trace_counter_t> m_trace_counters;
+
+    std::mutex m_buffers_mtx;
+    std::vector<GE::Shared<thread_buffer_t>> m_buffers;
+    // Indexes aren't reused, so threads stay apart in the trace
+    uint32_t m_threads_count{0};
+
+    std::thread m_collector;
+    std::mutex m_collector_mtx;
+    std::condition_variable m_collector_condition;
+    bool m_stop_collector{false};
+};
+
+} // namespace
+
+namespace GE::Debug {
+
+void Profiler::enable(bool enabled)
+{
+    Collector::get()->enable(enabled);
+}
+
+bool Profiler::isEnabled()
+{
+    return Collector::get()->isEnabled();
+}
+
+bool Profiler::isRecording()
+{
+    return Collector::get()->isRecording();
+}
+
+void Profiler::begin(const std::string& name, const std::string& filepath)
+{
+    Collector::get()->begin(name, filepath);
+}
+
+void Profiler::beginCapture(const std::string& name, const std::string& filepath,
+                            uint32_t frames_count, Timestamp frame_budget)
+{
+    Collector::get()->beginCapture(name, filepath, frames_count, frame_budget);
+}
+
+void Profiler::end()
+{
+    Collector::get()->end();
+}
+
+void Profiler::record(const char* name, int64_t start, int64_t end, Track track)
+{
+    Collector* collector = Collector::get();
+
+    if (collector->isRecording()) {
+        collector->record(name, start, end, track);
+    }
+}
+
+void Profiler::setLiveFramesCount(uint32_t frames_count)
+{
+    Collector::get()->setLiveFramesCount(frames_count);
+}
+
+void Profiler::readLiveFrames(const FrameReader& reader)
+{
+    Collector::get()->readLiveFrames(reader);
+}
+
+void Profiler::markFrame()
+{
+    Collector::get()->markFrame();
+}
+
+void Profiler::recordCounter(const char* name, int64_t value)
+{
+    record(name, now(), value, Track::COUNTER);
+}
+
+uint64_t Profiler::getDroppedCount()
+{
+    return Collector::get()->getDroppedCount();
+}
+
+} // namespace GE::Debug
+#endif // GE_PROFILING
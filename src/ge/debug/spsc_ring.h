@@ -0,0 +1,98 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// NOLINTNEXTLINE
+#ifndef GE_DEBUG_SPSC_RING_H_
+#define GE_DEBUG_SPSC_RING_H_
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <type_traits>
+#include <vector>
+
+namespace GE::Debug {
+
+// Bounded lock-free queue of trivially copyable values for exactly one
+// producer and one consumer thread. The consumer takes all the available values
+// at once.
+template<typename T, size_t Capacity>
+class SpscRing
+{
+public:
+    static_assert(std::is_trivially_copyable_v<T>, "Values must be trivially copyable");
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+    bool push(const T& value)
+    {
+        size_t head = m_head.load(std::memory_order_relaxed);
+
+        if (head - m_cached_tail == Capacity) {
+            m_cached_tail = m_tail.load(std::memory_order_acquire);
+
+            if (head - m_cached_tail == Capacity) {
+                return false;
+            }
+        }
+
+        m_values[head & MASK] = value;
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    size_t popAll(std::vector<T>* values)
+    {
+        size_t tail = m_tail.load(std::memory_order_relaxed);
+        size_t head = m_head.load(std::memory_order_acquire);
+        size_t count = head - tail;
+        size_t first = tail & MASK;
+        size_t first_count = std::min(count, Capacity - first);
+
+        values->insert(values->end(), &m_values[first], &m_values[first] + first_count);
+        values->insert(values->end(), &m_values[0], &m_values[0] + count - first_count);
+        m_tail.store(head, std::memory_order_release);
+        return count;
+    }
+
+private:
+    static constexpr size_t MASK{Capacity - 1};
+    static constexpr size_t CACHE_LINE_SIZE{64};
+
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_head{0};
+    size_t m_cached_tail{0};
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_tail{0};
+    alignas(CACHE_LINE_SIZE) std::array<T, Capacity> m_values{};
+};
+
+} // namespace GE::Debug
+
+#endif // GE_DEBUG_SPSC_RING_H_
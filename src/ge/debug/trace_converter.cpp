@@ -0,0 +1,70 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "trace_converter.h"
+#include "binary_trace_reader.h"
+#include "json_trace_writer.h"
+
+#include "ge/core/log.h"
+
+namespace GE::Debug {
+
+bool convertTraceToJson(const std::string& trace_file, const std::string& json_file)
+{
+    BinaryTraceReader reader;
+    JsonTraceWriter writer;
+
+    if (!reader.open(trace_file) || !writer.open(json_file, reader.getSessionName())) {
+        return false;
+    }
+
+    std::vector<trace_event_t> events;
+    std::vector<trace_counter_t> counters;
+
+    while (reader.read(&events, &counters)) {
+        writer.write(events);
+        writer.write(counters);
+        events.clear();
+        counters.clear();
+    }
+
+    writer.close(reader.getDroppedCount());
+
+    if (!reader.isCompleted()) {
+        GE_CORE_WARN("Trace '{}' is incomplete, converted events which have been read",
+                     trace_file);
+    }
+
+    return true;
+}
+
+} // namespace GE::Debug
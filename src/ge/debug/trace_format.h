@@ -0,0 +1,135 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// NOLINTNEXTLINE
+#ifndef GE_DEBUG_TRACE_FORMAT_H_
+#define GE_DEBUG_TRACE_FORMAT_H_
+
+#include "ge/debug/trace_event.h"
+
+#include <cstdint>
+#include <string>
+
+namespace GE::Debug {
+
+// A binary trace is the header followed by chunks:
+//   header: MAGIC, u32 VERSION
+//   chunk:  u8 type, u8 compression, u32 raw size, u32 stored size, payload
+// SESSION: varint name size, name
+// STRINGS: names of scopes and counters, varint size and characters each. A name gets the
+//          next index of the file-wide string table
+// EVENTS:  per-thread blocks: varint tid, varint event count and the events:
+//          varint name index, zigzag varint start delta from the previous event
+//          of the block, varint duration. Time is in nanoseconds
+// COUNTERS: varint sample count and the samples: varint name index, zigzag
+//          varint time delta from the previous sample, zigzag varint value
+// END:     varint count of the events dropped by the profiler
+// Integers are little-endian.
+namespace Trace {
+
+constexpr char MAGIC[8]{'G', 'E', 'T', 'R', 'A', 'C', 'E', '\0'};
+constexpr uint32_t VERSION{2};
+constexpr size_t CHUNK_HEADER_SIZE{10};
+
+enum class Chunk : uint8_t
+{
+    SESSION = 1,
+    STRINGS,
+    EVENTS,
+    END,
+    COUNTERS
+};
+
+enum class Compression : uint8_t
+{
+    NONE = 0,
+    LZ4
+};
+
+inline void writeU32(std::string* out, uint32_t value)
+{
+    for (uint32_t i{0}; i < 4; i++) {
+        out->push_back(static_cast<char>((value >> (i * 8)) & 0xFF));
+    }
+}
+
+inline uint32_t readU32(const char* data)
+{
+    uint32_t value{0};
+
+    for (uint32_t i{0}; i < 4; i++) {
+        value |= static_cast<uint32_t>(static_cast<uint8_t>(data[i])) << (i * 8);
+    }
+
+    return value;
+}
+
+inline void writeVarint(std::string* out, uint64_t value)
+{
+    while (value >= 0x80) {
+        out->push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+
+    out->push_back(static_cast<char>(value));
+}
+
+inline bool readVarint(const char** data, const char* end, uint64_t* value)
+{
+    *value = 0;
+
+    for (uint32_t shift{0}; *data != end && shift < 64; shift += 7) {
+        auto byte = static_cast<uint8_t>(*(*data)++);
+        *value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+
+        if ((byte & 0x80) == 0) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+inline uint64_t encodeZigzag(int64_t value)
+{
+    return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+inline int64_t decodeZigzag(uint64_t value)
+{
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+} // namespace Trace
+} // namespace GE::Debug
+
+#endif // GE_DEBUG_TRACE_FORMAT_H_
@@ -0,0 +1,126 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "trace_writer.h"
+#include "binary_trace_writer.h"
+#include "json_trace_writer.h"
+
+#include "ge/core/log.h"
+#include "ge/core/utils.h"
+
+#include <filesystem>
+
+namespace {
+
+constexpr size_t TRACE_WRITE_BUFFER_SIZE{1 << 20};
+constexpr auto TRACE_JSON_EXT = ".json";
+
+} // namespace
+
+namespace GE::Debug {
+
+TraceWriter::~TraceWriter()
+{
+    if (m_file != nullptr) {
+        std::fclose(m_file);
+    }
+}
+
+bool TraceWriter::open(const std::string& filepath, const std::string& session_name)
+{
+    close(0);
+    m_file = std::fopen(filepath.c_str(), "wb");
+
+    if (m_file == nullptr) {
+        GE_CORE_ERR("Unable to open trace file '{}'", filepath);
+        return false;
+    }
+
+    m_buffer.reserve(TRACE_WRITE_BUFFER_SIZE);
+    writeHeader(session_name);
+    return true;
+}
+
+void TraceWriter::write(const std::vector<trace_event_t>& events)
+{
+    if (m_file == nullptr || events.empty()) {
+        return;
+    }
+
+    writeEvents(events);
+
+    if (m_buffer.size() >= TRACE_WRITE_BUFFER_SIZE) {
+        flush();
+    }
+}
+
+void TraceWriter::write(const std::vector<trace_counter_t>& counters)
+{
+    if (m_file == nullptr || counters.empty()) {
+        return;
+    }
+
+    writeCounters(counters);
+
+    if (m_buffer.size() >= TRACE_WRITE_BUFFER_SIZE) {
+        flush();
+    }
+}
+
+void TraceWriter::close(uint64_t dropped_count)
+{
+    if (m_file == nullptr) {
+        return;
+    }
+
+    writeFooter(dropped_count);
+    flush();
+    std::fclose(m_file);
+    m_file = nullptr;
+}
+
+Scoped<TraceWriter> TraceWriter::create(const std::string& filepath)
+{
+    if (std::filesystem::path{filepath}.extension() == TRACE_JSON_EXT) {
+        return makeScoped<JsonTraceWriter>();
+    }
+
+    return makeScoped<BinaryTraceWriter>();
+}
+
+void TraceWriter::flush()
+{
+    std::fwrite(m_buffer.data(), 1, m_buffer.size(), m_file);
+    m_buffer.clear();
+}
+
+} // namespace GE::Debug
@@ -0,0 +1,78 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// NOLINTNEXTLINE
+#ifndef GE_DEBUG_TRACE_WRITER_H_
+#define GE_DEBUG_TRACE_WRITER_H_
+
+#include "trace_format.h"
+
+#include "ge/core/core.h"
+#include "ge/core/non_copyable.h"
+
+#include <cstdio>
+#include <vector>
+
+namespace GE::Debug {
+
+// Encodes events into a large buffer which is written to the file when it's
+// full, so there is a single write per a lot of events
+class TraceWriter: public NonCopyable
+{
+public:
+    ~TraceWriter() override;
+
+    bool open(const std::string& filepath, const std::string& session_name);
+    void write(const std::vector<trace_event_t>& events);
+    void write(const std::vector<trace_counter_t>& counters);
+    void close(uint64_t dropped_count);
+
+    // A '.json' file gets the Chrome trace format, any other one the binary format
+    static Scoped<TraceWriter> create(const std::string& filepath);
+
+protected:
+    virtual void writeHeader(const std::string& session_name) = 0;
+    virtual void writeEvents(const std::vector<trace_event_t>& events) = 0;
+    virtual void writeCounters(const std::vector<trace_counter_t>& counters) = 0;
+    virtual void writeFooter(uint64_t dropped_count) = 0;
+
+    std::string m_buffer;
+
+private:
+    void flush();
+
+    std::FILE* m_file{nullptr};
+};
+
+} // namespace GE::Debug
+
+#endif // GE_DEBUG_TRACE_WRITER_H_
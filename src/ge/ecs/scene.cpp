@@ -35,7 +35,10 @@
 
 #include "ge/core/begin.h"
 #include "ge/core/log.h"
+#include "ge/debug/counters.h"
+#include "ge/debug/memory.h"
 #include "ge/debug/profile.h"
+#include "ge/renderer/render_snapshot.h"
 #include "ge/renderer/renderer_2d.h"
 
 namespace GE {
@@ -44,18 +47,41 @@ void Scene::onUpdate(Timestamp dt)
 {
     GE_PROFILE_FUNC();
 
+    onSimulate(dt);
+
+    if (m_main_camera.isNull()) {
+        return;
+    }
+
+    Begin<GE::Renderer2D> begin{m_main_camera};
+
+    m_registry.eachEntityWith<TransformComponent, SpriteRendererComponent>(
+        [](Entity entity) { Renderer2D::draw(entity); });
+}
+
+void Scene::onSimulate(Timestamp dt)
+{
+    GE_PROFILE_FUNC();
+    GE_MEMORY_TAG(Debug::MemoryTag::ECS);
+
     m_registry.eachEntityWith<NativeScriptComponent>([dt](Entity entity) {
         entity.getComponent<NativeScriptComponent>().onUpdate(dt);
+        GE_COUNTER("Entities updated", 1);
     });
+}
+
+void Scene::onExtract(RenderSnapshot* snapshot)
+{
+    GE_PROFILE_FUNC();
 
     if (m_main_camera.isNull()) {
         return;
     }
 
-    Begin<GE::Renderer2D> begin{m_main_camera};
+    snapshot->beginView(m_main_camera);
 
     m_registry.eachEntityWith<TransformComponent, SpriteRendererComponent>(
-        [](Entity entity) { Renderer2D::draw(entity); });
+        [snapshot](Entity entity) { snapshot->addSprite(entity); });
 }
 
 void Scene::onViewportResize(const glm::vec2& viewport)
@@ -79,6 +105,7 @@ void Scene::eachEntity(const ForeachCallback& callback)
 Entity Scene::createEntity(const std::string& name)
 {
     GE_PROFILE_FUNC();
+    GE_MEMORY_TAG(Debug::MemoryTag::ECS);
 
     return m_registry.create(name);
 }
@@ -104,7 +131,8 @@ bool Scene::setMainCamera(const Entity& camera)
     GE_PROFILE_FUNC();
 
     if (!camera.hasComponent<CameraComponent>()) {
-        GE_CORE_ERR("Trying to set entity without CameraComponent as main camera");
+        GE_CORE_ERR_CAT(ECS,
+                        "Trying to set entity without CameraComponent as main camera");
         return false;
     }
 
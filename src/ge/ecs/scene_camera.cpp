@@ -86,8 +86,8 @@ void SceneCamera::calculateProjection()
         case ProjectionType::PERSPECTIVE: calculatePerspectiveProjection(); break;
         case ProjectionType::ORTHOGRAPHIC: calculateOrthographicProjection(); break;
         default:
-            GE_CORE_ERR("Unknown projection type: {}",
-                        static_cast<int>(m_projection_type));
+            GE_CORE_ERR_CAT(ECS, "Unknown projection type: {}",
+                            static_cast<int>(m_projection_type));
             break;
     }
 }
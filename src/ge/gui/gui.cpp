@@ -31,11 +31,15 @@
  */
 
 #include "gui.h"
+#include "headless/gui.h"
 
 #include "ge/application.h"
 #include "ge/core/log.h"
+#include "ge/debug/memory.h"
 #include "ge/debug/profile.h"
+#include "ge/renderer/gpu_profiler.h"
 #include "ge/renderer/render_command.h"
+#include "ge/renderer/renderer.h"
 #include "ge/window/input.h"
 #include "ge/window/key_event.h"
 #include "ge/window/mouse_event.h"
@@ -54,6 +58,21 @@ using PlatformGui = ::GE::UNIX::Gui;
 
 namespace {
 
+void* allocateGuiMemory(size_t size, void* /*user_data*/)
+{
+    return GE::Debug::Memory::allocate(size, GE::Debug::MemoryTag::GUI);
+}
+
+void freeGuiMemory(void* ptr, void* /*user_data*/)
+{
+    GE::Debug::Memory::deallocate(ptr);
+}
+
+bool isHeadless()
+{
+    return GE::RendererAPI::isHeadless(GE::Renderer::getAPI());
+}
+
 int32_t toImGuiButton(GE::MouseButton button)
 {
     switch (button) {
@@ -209,6 +228,7 @@ bool Gui::initialize()
 
     GE_CORE_DBG("Initialize GUI");
     IMGUI_CHECKVERSION();
+    ImGui::SetAllocatorFunctions(allocateGuiMemory, freeGuiMemory);
     ImGui::CreateContext();
 
     ImGuiIO& io = ImGui::GetIO();
@@ -225,7 +245,10 @@ bool Gui::initialize()
         style.Colors[ImGuiCol_WindowBg].w = 1.0f;
     }
 
-    if (!PlatformGui::initialize()) {
+    bool is_initialized =
+        isHeadless() ? Headless::Gui::initialize() : PlatformGui::initialize();
+
+    if (!is_initialized) {
         GE_CORE_ERR("Failed to initialize Platform::GUI");
         return false;
     }
@@ -239,43 +262,67 @@ void Gui::shutdown()
     GE_PROFILE_FUNC();
 
     GE_CORE_DBG("Shutdown GUI");
-    PlatformGui::shutdown();
+
+    if (isHeadless()) {
+        Headless::Gui::shutdown();
+    } else {
+        PlatformGui::shutdown();
+    }
+
     ImGui::DestroyContext();
 }
 
 void Gui::begin()
 {
     GE_PROFILE_FUNC();
+    GE_MEMORY_TAG(Debug::MemoryTag::GUI);
+
+    if (isHeadless()) {
+        Headless::Gui::newFrame();
+    } else {
+        PlatformGui::newFrame();
+    }
 
-    PlatformGui::newFrame();
     ImGui::NewFrame();
 }
 
 void Gui::end()
 {
     GE_PROFILE_FUNC();
+    GE_MEMORY_TAG(Debug::MemoryTag::GUI);
 
     ImGuiIO& io = ImGui::GetIO();
     const auto& window = Application::getWindow();
     io.DisplaySize = ImVec2(window.getWidth(), window.getHeight());
 
     ImGui::Render();
-    PlatformGui::render();
+    GE_PROFILE_GPU_SCOPE("ImGui Render");
+
+    if (isHeadless()) {
+        Headless::Gui::render();
+    } else {
+        PlatformGui::render();
+    }
 }
 
 void Gui::onEvent(Event* event)
 {
     GE_PROFILE_FUNC();
-    EventDispatcher dispatcher(event);
-
-    dispatcher.dispatch<KeyPressedEvent>(onKeyPressed);
-    dispatcher.dispatch<KeyReleasedEvent>(onKeyReleased);
-    dispatcher.dispatch<KeyTypedEvent>(onKeyTyped);
-    dispatcher.dispatch<MouseMovedEvent>(onMouseMoved);
-    dispatcher.dispatch<MouseScrolledEvent>(onMouseScrolled);
-    dispatcher.dispatch<MouseButtonPressedEvent>(onMouseButtonPressed);
-    dispatcher.dispatch<MouseButtonReleasedEvent>(onMouseButtonReleased);
-    dispatcher.dispatch<WindowResizedEvent>(onWindowResized);
+
+    static const auto handlers = [] {
+        EventHandlerTable<> handlers;
+        handlers.add<KeyPressedEvent, onKeyPressed>();
+        handlers.add<KeyReleasedEvent, onKeyReleased>();
+        handlers.add<KeyTypedEvent, onKeyTyped>();
+        handlers.add<MouseMovedEvent, onMouseMoved>();
+        handlers.add<MouseScrolledEvent, onMouseScrolled>();
+        handlers.add<MouseButtonPressedEvent, onMouseButtonPressed>();
+        handlers.add<MouseButtonReleasedEvent, onMouseButtonReleased>();
+        handlers.add<WindowResizedEvent, onWindowResized>();
+        return handlers;
+    }();
+
+    handlers.dispatch(event);
 }
 
 } // namespace GE
@@ -0,0 +1,100 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "gui.h"
+
+#include "ge/application.h"
+#include "ge/core/log.h"
+#include "ge/core/timestamp.h"
+#include "ge/debug/profile.h"
+
+#include <imgui.h>
+
+#include <algorithm>
+
+#define BACKEND_NAME "ge_headless"
+
+namespace {
+
+GE::Timestamp prev_frame_time;
+
+} // namespace
+
+namespace GE::Headless {
+
+bool Gui::initialize()
+{
+    GE_PROFILE_FUNC();
+    GE_CORE_DBG("Initialize Headless::PlatformImGui");
+
+    ImGuiIO& io = ImGui::GetIO();
+    io.BackendPlatformName = BACKEND_NAME;
+    io.BackendRendererName = BACKEND_NAME;
+    io.ConfigFlags &= ~ImGuiConfigFlags_ViewportsEnable;
+
+    // There is no renderer to upload the font atlas to, but ImGui requires it to be built
+    unsigned char* pixels{nullptr};
+    int width{};
+    int height{};
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+
+    prev_frame_time = Timestamp::now();
+    return true;
+}
+
+void Gui::shutdown()
+{
+    GE_PROFILE_FUNC();
+
+    GE_CORE_DBG("Shutdown Headless::PlatformImGui");
+    ImGuiIO& io = ImGui::GetIO();
+    io.BackendPlatformName = nullptr;
+    io.BackendRendererName = nullptr;
+}
+
+void Gui::newFrame()
+{
+    GE_PROFILE_FUNC();
+
+    constexpr float min_delta_time{1e-6f};
+    const auto& window = Application::getWindow();
+    Timestamp now = Timestamp::now();
+
+    ImGuiIO& io = ImGui::GetIO();
+    io.DisplaySize = ImVec2(window.getWidth(), window.getHeight());
+    io.DeltaTime = std::max(static_cast<float>(now - prev_frame_time), min_delta_time);
+    prev_frame_time = now;
+}
+
+void Gui::render() {}
+
+} // namespace GE::Headless
@@ -43,9 +43,7 @@ LayerStack::~LayerStack()
 {
     GE_PROFILE_FUNC();
 
-    for (auto& layer : m_stack) {
-        layer->onDetach();
-    }
+    clear();
 }
 
 void LayerStack::pushLayer(Shared<Layer> layer)
@@ -90,4 +88,16 @@ void LayerStack::popOverlay(const Shared<Layer>& overlay)
     }
 }
 
+void LayerStack::clear()
+{
+    GE_PROFILE_FUNC();
+
+    for (auto& layer : m_stack) {
+        layer->onDetach();
+    }
+
+    m_stack.clear();
+    m_last_layer_idx = 0;
+}
+
 } // namespace GE
@@ -35,12 +35,26 @@
 
 #include "ge/application.h"
 #include "ge/core/log.h"
+#include "ge/debug/memory.h"
 #include "ge/debug/profile.h"
 #include "ge/gui/gui.h"
 #include "ge/renderer/renderer.h"
 #include "ge/renderer/renderer_2d.h"
 #include "ge/window/window.h"
 
+namespace {
+
+bool initializeApplication(const GE::AppProperties::properties_t& props)
+{
+    if (props.headless) {
+        return GE::Application::initializeHeadless(props.window, props.headless_props);
+    }
+
+    return GE::Application::initialize(props.window);
+}
+
+} // namespace
+
 namespace GE {
 
 Manager::~Manager()
@@ -65,17 +79,50 @@ bool Manager::initialize(std::string props_file)
         return false;
     }
 
+    // Properties are read with the default log, so it can report errors
+    if (props.log.async || props.log.deferred || !props.log.file.empty()) {
+        Log::shutdown();
+
+        if (!Log::initialize(props.log)) {
+            return false;
+        }
+    }
+
     Log::core()->setLevel(props.core_log_lvl);
     Log::client()->setLevel(props.client_log_lvl);
 
+    for (size_t tag{0}; tag < props.memory_budgets.size(); tag++) {
+        Debug::Memory::setBudget(static_cast<Debug::MemoryTag>(tag),
+                                 props.memory_budgets[tag]);
+    }
+
     if (!Renderer::initialize(props.api) || !Window::initialize() ||
-        !Application::initialize(props.window) ||
-        !Renderer2D::initialize(props.assets_dir) || !Gui::initialize()) {
+        !initializeApplication(props) || !Renderer2D::initialize(props.assets_dir)) {
+        return false;
+    }
+
+    // The GUI needs a window to draw on
+    if (!props.headless && !Gui::initialize()) {
+        return false;
+    }
+
+    Application::setFixedTimestep(props.fixed_timestep);
+    Application::setPipelinedRendering(props.pipelined_rendering);
+    Application::setFramePacing(props.frame_pacing);
+
+    if (!props.record_input.empty() && !Application::recordInput(props.record_input)) {
+        return false;
+    }
+
+    if (!props.replay_input.empty() && !Application::replayInput(props.replay_input)) {
         return false;
     }
 
     GE_CORE_DBG("GameEngine: has been initialized");
     get()->m_props_file = std::move(props_file);
+    get()->m_record_input = props.record_input;
+    get()->m_replay_input = props.replay_input;
+    get()->m_headless_props = props.headless_props;
     get()->m_initialized = true;
     return true;
 }
@@ -85,16 +132,28 @@ void Manager::shutdown()
     GE_PROFILE_FUNC();
 
     GE_CORE_DBG("GameEngine: scheduling shutdown");
-    get()->saveProperties();
 
-    Gui::shutdown();
+    // Batch runs may share the config, so a headless run doesn't write it. There
+    // is no GUI to shut down either
+    if (!Application::isHeadless()) {
+        get()->saveProperties();
+        Gui::shutdown();
+    }
+
     Renderer2D::shutdown();
     Application::shutdown();
     Window::shutdown();
     Renderer::shutdown();
     Log::shutdown();
 
+    for (size_t tag{0}; tag < static_cast<size_t>(Debug::MemoryTag::COUNT); tag++) {
+        Debug::Memory::setBudget(static_cast<Debug::MemoryTag>(tag), 0);
+    }
+
     get()->m_props_file.clear();
+    get()->m_record_input.clear();
+    get()->m_replay_input.clear();
+    get()->m_headless_props = {};
     get()->m_initialized = false;
 }
 
@@ -108,7 +167,19 @@ void Manager::saveProperties() const
     props.core_log_lvl = Log::core()->getLvel();
     props.client_log_lvl = Log::client()->getLvel();
     props.assets_dir = Renderer2D::getAssetsDir();
+    props.log = Log::getProperties();
     props.window = Application::getWindow().getProps();
+    props.pipelined_rendering = Application::isPipelinedRendering();
+    props.frame_pacing = Application::getFramePacer().getProperties();
+    props.fixed_timestep = Application::getFixedTimestep().getProperties();
+    props.record_input = m_record_input;
+    props.replay_input = m_replay_input;
+    props.headless_props = m_headless_props;
+
+    for (size_t tag{0}; tag < props.memory_budgets.size(); tag++) {
+        props.memory_budgets[tag] =
+            Debug::Memory::getStats(static_cast<Debug::MemoryTag>(tag)).budget;
+    }
 
     AppProperties::write(m_props_file, props);
 }
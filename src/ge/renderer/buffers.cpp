@@ -31,41 +31,48 @@
  */
 
 #include "buffers.h"
+#include "headless/buffers.h"
 #include "opengl/buffers.h"
 #include "renderer.h"
 
 #include "ge/core/asserts.h"
-#include "ge/core/utils.h"
+#include "ge/core/pool.h"
 
 namespace GE {
 
-Scoped<VertexBuffer> VertexBuffer::create(const float* vertices, uint32_t size)
+Shared<VertexBuffer> VertexBuffer::create(const float* vertices, uint32_t size)
 {
     switch (Renderer::getAPI()) {
-        case GE_OPEN_GL_API: return makeScoped<OpenGL::VertexBuffer>(vertices, size);
+        case GE_OPEN_GL_API: return makePooled<OpenGL::VertexBuffer>(vertices, size);
+        case GE_HEADLESS_API:
+        case GE_SOFTWARE_API: return makePooled<Headless::VertexBuffer>(vertices, size);
         default: GE_CORE_ASSERT_MSG(false, "Unsupported API: '{}'", Renderer::getAPI());
     }
 
     return nullptr;
 }
 
-Scoped<VertexBuffer> VertexBuffer::create(uint32_t size)
+Shared<VertexBuffer> VertexBuffer::create(uint32_t size)
 {
     using Usage = OpenGL::BufferBase::Usage;
 
     switch (Renderer::getAPI()) {
         case GE_OPEN_GL_API:
-            return makeScoped<OpenGL::VertexBuffer>(nullptr, size, Usage::DYNAMIC);
+            return makePooled<OpenGL::VertexBuffer>(nullptr, size, Usage::DYNAMIC);
+        case GE_HEADLESS_API:
+        case GE_SOFTWARE_API: return makePooled<Headless::VertexBuffer>(nullptr, size);
         default: GE_CORE_ASSERT_MSG(false, "Unsupported API: '{}'", Renderer::getAPI());
     }
 
     return nullptr;
 }
 
-Scoped<IndexBuffer> IndexBuffer::create(const uint32_t* indexes, uint32_t count)
+Shared<IndexBuffer> IndexBuffer::create(const uint32_t* indexes, uint32_t count)
 {
     switch (Renderer::getAPI()) {
-        case GE_OPEN_GL_API: return makeScoped<OpenGL::IndexBuffer>(indexes, count);
+        case GE_OPEN_GL_API: return makePooled<OpenGL::IndexBuffer>(indexes, count);
+        case GE_HEADLESS_API:
+        case GE_SOFTWARE_API: return makePooled<Headless::IndexBuffer>(indexes, count);
         default: GE_CORE_ASSERT_MSG(false, "Unsupported API: '{}'", Renderer::getAPI());
     }
 
@@ -31,6 +31,7 @@
  */
 
 #include "framebuffer.h"
+#include "headless/framebuffer.h"
 #include "opengl/framebuffer.h"
 #include "renderer.h"
 
@@ -46,6 +47,8 @@ Scoped<GE::Framebuffer> Framebuffer::create(const properties_t& props)
 
     switch (Renderer::getAPI()) {
         case GE_OPEN_GL_API: return makeScoped<OpenGL::Framebuffer>(props);
+        case GE_HEADLESS_API:
+        case GE_SOFTWARE_API: return makeScoped<Headless::Framebuffer>(props);
         default: GE_CORE_ASSERT_MSG(false, "Unsupported API: '{}'", Renderer::getAPI());
     }
 
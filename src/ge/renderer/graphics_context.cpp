@@ -31,6 +31,7 @@
  */
 
 #include "graphics_context.h"
+#include "headless/graphics_context.h"
 #include "renderer.h"
 
 #include "ge/core/asserts.h"
@@ -49,6 +50,8 @@ Scoped<GraphicsContext> GraphicsContext::create(void* window)
 {
     switch (Renderer::getAPI()) {
         case GE_OPEN_GL_API: return makeScoped<OpenGLContext>(window);
+        case GE_HEADLESS_API:
+        case GE_SOFTWARE_API: return makeScoped<Headless::GraphicsContext>();
         default: GE_CORE_ASSERT_MSG(false, "Unsupported API: '{}'", Renderer::getAPI());
     }
 
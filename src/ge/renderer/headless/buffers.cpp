@@ -0,0 +1,67 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "buffers.h"
+
+#include "ge/core/asserts.h"
+#include "ge/debug/profile.h"
+
+#include <cstring>
+
+namespace GE::Headless {
+
+VertexBuffer::VertexBuffer(const float* vertices, uint32_t size)
+    : m_data(size)
+{
+    GE_PROFILE_FUNC();
+
+    if (vertices != nullptr) {
+        std::memcpy(m_data.data(), vertices, size);
+    }
+}
+
+void VertexBuffer::setData(const void* data, uint32_t size)
+{
+    GE_PROFILE_FUNC();
+
+    GE_CORE_ASSERT_MSG(size <= m_data.size(), "Vertex buffer overflow: {} > {}", size,
+                       m_data.size());
+    std::memcpy(m_data.data(), data, size);
+}
+
+IndexBuffer::IndexBuffer(const uint32_t* indexes, uint32_t count)
+    : m_indexes(indexes, indexes + count)
+{
+    GE_PROFILE_FUNC();
+}
+
+} // namespace GE::Headless
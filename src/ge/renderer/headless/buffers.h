@@ -0,0 +1,82 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// NOLINTNEXTLINE
+#ifndef GE_RENDERER_HEADLESS_BUFFERS_H_
+#define GE_RENDERER_HEADLESS_BUFFERS_H_
+
+#include "ge/renderer/buffers.h"
+
+#include <vector>
+
+namespace GE::Headless {
+
+class VertexBuffer: public ::GE::VertexBuffer
+{
+public:
+    VertexBuffer(const float* vertices, uint32_t size);
+
+    void bind() const override {}
+    void unbind() const override {}
+
+    void setLayout(const BufferLayout& layout) override { m_layout = layout; }
+    const BufferLayout& getLayout() const override { return m_layout; }
+
+    void setData(const void* data, uint32_t size) override;
+
+    const uint8_t* data() const { return m_data.data(); }
+    uint32_t size() const { return m_data.size(); }
+
+private:
+    BufferLayout m_layout;
+    std::vector<uint8_t> m_data;
+};
+
+class IndexBuffer: public ::GE::IndexBuffer
+{
+public:
+    IndexBuffer(const uint32_t* indexes, uint32_t count);
+
+    void bind() const override {}
+    void unbind() const override {}
+
+    uint32_t getCount() const override { return m_indexes.size(); }
+
+    const uint32_t* data() const { return m_indexes.data(); }
+
+private:
+    std::vector<uint32_t> m_indexes;
+};
+
+} // namespace GE::Headless
+
+#endif // GE_RENDERER_HEADLESS_BUFFERS_H_
@@ -0,0 +1,101 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "device.h"
+
+#include "ge/core/asserts.h"
+
+#include <algorithm>
+
+namespace GE::Headless {
+
+void Device::bindFramebuffer(Framebuffer* framebuffer)
+{
+    get()->m_framebuffer = framebuffer;
+}
+
+void Device::bindShaderProgram(const ShaderProgram* shader_program)
+{
+    get()->m_shader_program = shader_program;
+}
+
+void Device::bindTexture(uint32_t slot, const Texture2D* texture)
+{
+    GE_CORE_ASSERT_MSG(slot < GE_HEADLESS_TEXTURE_SLOTS_MAX, "Wrong texture slot: {}",
+                       slot);
+    get()->m_textures[slot] = texture;
+}
+
+void Device::bindVertexArray(const VertexArray* vertex_array)
+{
+    get()->m_vertex_array = vertex_array;
+}
+
+void Device::setViewport(const glm::uvec4& viewport)
+{
+    get()->m_viewport = viewport;
+}
+
+void Device::release(const Framebuffer* framebuffer)
+{
+    if (get()->m_framebuffer == framebuffer) {
+        get()->m_framebuffer = nullptr;
+    }
+}
+
+void Device::release(const ShaderProgram* shader_program)
+{
+    if (get()->m_shader_program == shader_program) {
+        get()->m_shader_program = nullptr;
+    }
+}
+
+void Device::release(const Texture2D* texture)
+{
+    auto& textures = get()->m_textures;
+    std::replace(textures.begin(), textures.end(), texture,
+                 static_cast<const Texture2D*>(nullptr));
+}
+
+void Device::release(const VertexArray* vertex_array)
+{
+    if (get()->m_vertex_array == vertex_array) {
+        get()->m_vertex_array = nullptr;
+    }
+}
+
+uint32_t Device::generateID()
+{
+    return ++get()->m_last_id;
+}
+
+} // namespace GE::Headless
@@ -0,0 +1,98 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// NOLINTNEXTLINE
+#ifndef GE_RENDERER_HEADLESS_DEVICE_H_
+#define GE_RENDERER_HEADLESS_DEVICE_H_
+
+#include "ge/core/core.h"
+
+#include <glm/glm.hpp>
+
+#include <array>
+#include <cstdint>
+
+#define GE_HEADLESS_TEXTURE_SLOTS_MAX 32
+
+namespace GE::Headless {
+
+class Framebuffer;
+class ShaderProgram;
+class Texture2D;
+class VertexArray;
+
+// Keeps track of the objects bound by the headless backend the same way as
+// an OpenGL context keeps its binding points.
+class Device
+{
+public:
+    using TextureSlots = std::array<const Texture2D*, GE_HEADLESS_TEXTURE_SLOTS_MAX>;
+
+    static void bindFramebuffer(Framebuffer* framebuffer);
+    static void bindShaderProgram(const ShaderProgram* shader_program);
+    static void bindTexture(uint32_t slot, const Texture2D* texture);
+    static void bindVertexArray(const VertexArray* vertex_array);
+    static void setViewport(const glm::uvec4& viewport);
+
+    static void release(const Framebuffer* framebuffer);
+    static void release(const ShaderProgram* shader_program);
+    static void release(const Texture2D* texture);
+    static void release(const VertexArray* vertex_array);
+
+    static Framebuffer* getFramebuffer() { return get()->m_framebuffer; }
+    static const ShaderProgram* getShaderProgram() { return get()->m_shader_program; }
+    static const TextureSlots& getTextures() { return get()->m_textures; }
+    static const VertexArray* getVertexArray() { return get()->m_vertex_array; }
+    static const glm::uvec4& getViewport() { return get()->m_viewport; }
+
+    static uint32_t generateID();
+
+private:
+    Device() = default;
+
+    static Device* get()
+    {
+        static Device instance;
+        return &instance;
+    }
+
+    Framebuffer* m_framebuffer{nullptr};
+    const ShaderProgram* m_shader_program{nullptr};
+    TextureSlots m_textures{};
+    const VertexArray* m_vertex_array{nullptr};
+    glm::uvec4 m_viewport{0};
+    uint32_t m_last_id{0};
+};
+
+} // namespace GE::Headless
+
+#endif // GE_RENDERER_HEADLESS_DEVICE_H_
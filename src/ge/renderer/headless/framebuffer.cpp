@@ -0,0 +1,127 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "framebuffer.h"
+#include "device.h"
+
+#include "ge/core/log.h"
+#include "ge/debug/profile.h"
+
+#include <algorithm>
+
+#define DEPTH_CLEAR_VALUE 1.0f
+
+namespace {
+
+uint32_t toRGBA8(const glm::vec4& color)
+{
+    auto to_byte = [](float value) {
+        return static_cast<uint32_t>(std::clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f);
+    };
+
+    return to_byte(color.r) | to_byte(color.g) << 8u | to_byte(color.b) << 16u |
+           to_byte(color.a) << 24u;
+}
+
+} // namespace
+
+namespace GE::Headless {
+
+Framebuffer::Framebuffer(const GE::Framebuffer::properties_t& props)
+    : m_props{props}
+{
+    GE_PROFILE_FUNC();
+
+    create();
+}
+
+Framebuffer::~Framebuffer()
+{
+    Device::release(this);
+}
+
+void Framebuffer::bind()
+{
+    GE_PROFILE_FUNC();
+
+    Device::bindFramebuffer(this);
+    Device::setViewport({0, 0, m_props.width, m_props.height});
+}
+
+void Framebuffer::unbind()
+{
+    GE_PROFILE_FUNC();
+
+    Device::bindFramebuffer(nullptr);
+}
+
+void Framebuffer::resize(const glm::vec2& size)
+{
+    GE_PROFILE_FUNC();
+
+    if (size.x <= 0 || size.y <= 0) {
+        GE_CORE_ERR_CAT(RENDERER, "Attempted to resize framebuffer to ({}, {})", size.x,
+                        size.y);
+        return;
+    }
+
+    m_props.width = size.x;
+    m_props.height = size.y;
+
+    create();
+}
+
+std::vector<uint32_t> Framebuffer::readColorAttachment() const
+{
+    return m_color_attachment;
+}
+
+void Framebuffer::clear(const glm::vec4& color)
+{
+    GE_PROFILE_FUNC();
+
+    std::fill(m_color_attachment.begin(), m_color_attachment.end(), toRGBA8(color));
+    std::fill(m_depth_attachment.begin(), m_depth_attachment.end(), DEPTH_CLEAR_VALUE);
+}
+
+void Framebuffer::create()
+{
+    GE_PROFILE_FUNC();
+
+    size_t pixel_count = m_props.width * m_props.height;
+
+    m_color_attachment_id = Device::generateID();
+    m_color_attachment.assign(pixel_count, 0);
+    m_depth_attachment.assign(pixel_count, DEPTH_CLEAR_VALUE);
+}
+
+} // namespace GE::Headless
@@ -0,0 +1,76 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// NOLINTNEXTLINE(llvm-header-guard)
+#ifndef GE_RENDERER_HEADLESS_FRAMEBUFFER_H_
+#define GE_RENDERER_HEADLESS_FRAMEBUFFER_H_
+
+#include <ge/renderer/framebuffer.h>
+
+#include <vector>
+
+namespace GE::Headless {
+
+class Framebuffer: public ::GE::Framebuffer
+{
+public:
+    explicit Framebuffer(const properties_t& props);
+    ~Framebuffer() override;
+
+    void bind() override;
+    void unbind() override;
+
+    void resize(const glm::vec2& size) override;
+
+    uint32_t getColorAttachmentID() const override { return m_color_attachment_id; }
+    const properties_t& getProps() const override { return m_props; }
+
+    std::vector<uint32_t> readColorAttachment() const override;
+
+    void clear(const glm::vec4& color);
+
+    uint32_t* getColorAttachment() { return m_color_attachment.data(); }
+    const uint32_t* getColorAttachment() const { return m_color_attachment.data(); }
+    float* getDepthAttachment() { return m_depth_attachment.data(); }
+
+private:
+    void create();
+
+    uint32_t m_color_attachment_id{};
+    std::vector<uint32_t> m_color_attachment;
+    std::vector<float> m_depth_attachment;
+    properties_t m_props{};
+};
+
+} // namespace GE::Headless
+
+#endif // GE_RENDERER_HEADLESS_FRAMEBUFFER_H_
@@ -0,0 +1,428 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rasterizer.h"
+#include "texture.h"
+
+#include "ge/core/frame_arena.h"
+#include "ge/debug/profile.h"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+    #define GE_RASTERIZER_SSE2
+#endif
+
+#define TILE_SIZE     64
+#define SIMD_WIDTH    4
+#define CHANNEL_SCALE 255.0f
+
+namespace {
+
+float edgeFunction(const glm::vec2& origin, const glm::vec2& delta, float x, float y)
+{
+    return (x - origin.x) * delta.y - (y - origin.y) * delta.x;
+}
+
+glm::vec4 toColor(uint32_t rgba)
+{
+    return glm::vec4{rgba & 0xFFu, (rgba >> 8u) & 0xFFu, (rgba >> 16u) & 0xFFu,
+                     (rgba >> 24u) & 0xFFu} /
+           CHANNEL_SCALE;
+}
+
+uint32_t toRGBA8(const glm::vec4& color)
+{
+    auto to_byte = [](float value) {
+        return static_cast<uint32_t>(std::clamp(value, 0.0f, 1.0f) * CHANNEL_SCALE +
+                                     0.5f);
+    };
+
+    return to_byte(color.r) | to_byte(color.g) << 8u | to_byte(color.b) << 16u |
+           to_byte(color.a) << 24u;
+}
+
+glm::vec4 sampleTexture(const GE::Headless::Texture2D& texture, const glm::vec2& uv)
+{
+    uint32_t width = texture.getWidth();
+    uint32_t height = texture.getHeight();
+
+    if (width == 0 || height == 0) {
+        return glm::vec4{1.0f};
+    }
+
+    // Nearest filter with GL_REPEAT wrapping
+    float u = uv.x - std::floor(uv.x);
+    float v = uv.y - std::floor(uv.y);
+    uint32_t x = std::min(static_cast<uint32_t>(u * width), width - 1);
+    uint32_t y = std::min(static_cast<uint32_t>(v * height), height - 1);
+
+    uint32_t bpp = texture.getBPP();
+    const uint8_t* texel = texture.data() + (y * width + x) * bpp;
+
+    switch (bpp) {
+        case 1: return glm::vec4{glm::vec3{texel[0] / CHANNEL_SCALE}, 1.0f};
+        case 2: return glm::vec4{glm::vec3{texel[0]}, texel[1]} / CHANNEL_SCALE;
+        case 3:
+            return glm::vec4{glm::vec3{texel[0], texel[1], texel[2]} / CHANNEL_SCALE,
+                             1.0f};
+        default:
+            return glm::vec4{texel[0], texel[1], texel[2], texel[3]} / CHANNEL_SCALE;
+    }
+}
+
+} // namespace
+
+namespace GE::Headless {
+
+Rasterizer::Rasterizer(uint32_t threads_num)
+    : m_threads_num{threads_num}
+{
+    if (m_threads_num > 1) {
+        m_thread_pool.start(m_threads_num, false);
+    }
+}
+
+void Rasterizer::draw(const target_t& target, const std::vector<vertex_t>& vertices,
+                      const uint32_t* indexes, uint32_t index_count,
+                      const Device::TextureSlots& textures)
+{
+    GE_PROFILE_FUNC();
+
+    m_triangles.clear();
+
+    for (uint32_t i{0}; i + 2 < index_count; i += 3) {
+        triangle_t triangle{};
+
+        if (setupTriangle(target, vertices[indexes[i]], vertices[indexes[i + 1]],
+                          vertices[indexes[i + 2]], textures, &triangle)) {
+            m_triangles.push_back(triangle);
+        }
+    }
+
+    if (m_triangles.empty()) {
+        return;
+    }
+
+    uint32_t tiles_x = (target.width + TILE_SIZE - 1) / TILE_SIZE;
+    uint32_t tiles_y = (target.height + TILE_SIZE - 1) / TILE_SIZE;
+    binTriangles(tiles_x, tiles_y);
+
+    // A task captures a single pointer, so std::function doesn't allocate it
+    FrameVector<tile_t> tiles;
+    tiles.reserve(m_threads_num > 1 ? tiles_x * tiles_y : 0);
+
+    for (uint32_t tile_y{0}; tile_y < tiles_y; tile_y++) {
+        for (uint32_t tile_x{0}; tile_x < tiles_x; tile_x++) {
+            const auto& bin = m_bins[tile_y * tiles_x + tile_x];
+
+            if (bin.empty()) {
+                continue;
+            }
+
+            if (m_threads_num > 1) {
+                const auto* tile = &tiles.emplace_back(
+                    tile_t{this, &target, &bin, tile_x, tile_y});
+                m_thread_pool.enqueue([tile] {
+                    tile->rasterizer->rasterizeTile(*tile->target, tile->x, tile->y,
+                                                    *tile->bin);
+                });
+            } else {
+                rasterizeTile(target, tile_x, tile_y, bin);
+            }
+        }
+    }
+
+    m_thread_pool.wait();
+}
+
+bool Rasterizer::setupTriangle(const target_t& target, const vertex_t& v0,
+                               const vertex_t& v1, const vertex_t& v2,
+                               const Device::TextureSlots& textures,
+                               triangle_t* triangle) const
+{
+    const vertex_t* vertices[] = {&v0, &v1, &v2};
+    glm::vec2 screen_pos[3];
+
+    for (size_t i{0}; i < 3; i++) {
+        const auto& position = vertices[i]->position;
+
+        // Primitives crossing the near plane are not clipped, so reject them
+        if (position.w <= 0.0f) {
+            return false;
+        }
+
+        float inv_w = 1.0f / position.w;
+        glm::vec3 ndc = glm::vec3{position} * inv_w;
+
+        screen_pos[i].x = (ndc.x * 0.5f + 0.5f) * target.viewport.z + target.viewport.x;
+        screen_pos[i].y = (ndc.y * 0.5f + 0.5f) * target.viewport.w + target.viewport.y;
+        triangle->depth[i] = ndc.z * 0.5f + 0.5f;
+        triangle->inv_w[i] = inv_w;
+        triangle->color_w[i] = vertices[i]->color * inv_w;
+        triangle->tex_coord_w[i] = vertices[i]->tex_coord * inv_w;
+    }
+
+    // Edges are always evaluated from the same end point, so the edge shared by
+    // two triangles produces exactly opposite values and the top-left rule
+    // assigns pixels lying on it to only one of them
+    auto make_edge = [](const glm::vec2& from, const glm::vec2& to) {
+        bool swap = from.y > to.y || (from.y == to.y && from.x > to.x);
+
+        edge_t edge{};
+        edge.origin = swap ? to : from;
+        edge.delta = swap ? from - to : to - from;
+        edge.sign = swap ? -1.0f : 1.0f;
+        return edge;
+    };
+
+    triangle->edges[0] = make_edge(screen_pos[1], screen_pos[2]);
+    triangle->edges[1] = make_edge(screen_pos[2], screen_pos[0]);
+    triangle->edges[2] = make_edge(screen_pos[0], screen_pos[1]);
+
+    const auto& last_edge = triangle->edges[2];
+    float area = last_edge.sign * edgeFunction(last_edge.origin, last_edge.delta,
+                                               screen_pos[2].x, screen_pos[2].y);
+
+    if (area == 0.0f || std::isnan(area)) {
+        return false;
+    }
+
+    for (auto& edge : triangle->edges) {
+        edge.sign = area > 0.0f ? edge.sign : -edge.sign;
+
+        float gradient_x = edge.sign * edge.delta.y;
+        float gradient_y = -edge.sign * edge.delta.x;
+        edge.top_left = gradient_x > 0.0f || (gradient_x == 0.0f && gradient_y > 0.0f);
+    }
+
+    glm::vec2 min_pos = glm::min(screen_pos[0], glm::min(screen_pos[1], screen_pos[2]));
+    glm::vec2 max_pos = glm::max(screen_pos[0], glm::max(screen_pos[1], screen_pos[2]));
+    glm::vec2 viewport_min{target.viewport.x, target.viewport.y};
+    glm::vec2 viewport_max{
+        std::min(target.viewport.x + target.viewport.z, target.width),
+        std::min(target.viewport.y + target.viewport.w, target.height)};
+
+    glm::ivec2 bbox_min{glm::max(glm::floor(min_pos), viewport_min)};
+    glm::ivec2 bbox_max{glm::min(glm::ceil(max_pos), viewport_max)};
+    triangle->bbox = {bbox_min, bbox_max};
+
+    if (triangle->bbox.x >= triangle->bbox.z || triangle->bbox.y >= triangle->bbox.w) {
+        return false;
+    }
+
+    // Renderer2D emits the texture index and the tiling factor per quad
+    auto tex_slot = static_cast<int32_t>(v0.tex_index);
+    triangle->tiling_factor = v0.tiling_factor;
+    triangle->texture = tex_slot >= 0 && static_cast<size_t>(tex_slot) < textures.size()
+                            ? textures[tex_slot]
+                            : nullptr;
+
+    return true;
+}
+
+void Rasterizer::binTriangles(uint32_t tiles_x, uint32_t tiles_y)
+{
+    GE_PROFILE_FUNC();
+
+    m_bins.resize(tiles_x * tiles_y);
+
+    for (auto& bin : m_bins) {
+        bin.clear();
+    }
+
+    for (uint32_t i{0}; i < m_triangles.size(); i++) {
+        const auto& bbox = m_triangles[i].bbox;
+
+        for (int32_t tile_y = bbox.y / TILE_SIZE; tile_y <= (bbox.w - 1) / TILE_SIZE;
+             tile_y++) {
+            for (int32_t tile_x = bbox.x / TILE_SIZE; tile_x <= (bbox.z - 1) / TILE_SIZE;
+                 tile_x++) {
+                m_bins[tile_y * tiles_x + tile_x].push_back(i);
+            }
+        }
+    }
+}
+
+void Rasterizer::rasterizeTile(const target_t& target, uint32_t tile_x, uint32_t tile_y,
+                               const std::vector<uint32_t>& bin) const
+{
+    GE_PROFILE_FUNC();
+
+    glm::ivec4 tile{tile_x * TILE_SIZE, tile_y * TILE_SIZE,
+                    std::min((tile_x + 1) * TILE_SIZE, target.width),
+                    std::min((tile_y + 1) * TILE_SIZE, target.height)};
+
+    for (auto triangle_idx : bin) {
+        const auto& triangle = m_triangles[triangle_idx];
+        glm::ivec4 rect{std::max(tile.x, triangle.bbox.x),
+                        std::max(tile.y, triangle.bbox.y),
+                        std::min(tile.z, triangle.bbox.z),
+                        std::min(tile.w, triangle.bbox.w)};
+
+        if (rect.x < rect.z && rect.y < rect.w) {
+            rasterizeTriangle(target, triangle, rect);
+        }
+    }
+}
+
+#if defined(GE_RASTERIZER_SSE2)
+
+void Rasterizer::rasterizeTriangle(const target_t& target, const triangle_t& triangle,
+                                   const glm::ivec4& rect) const
+{
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 lane_offsets = _mm_set_ps(3.5f, 2.5f, 1.5f, 0.5f);
+    const __m128 x_end = _mm_set1_ps(static_cast<float>(rect.z));
+
+    __m128 origin_x[3];
+    __m128 delta_y[3];
+    __m128 sign[3];
+    __m128 top_left[3];
+
+    for (size_t i{0}; i < 3; i++) {
+        const auto& edge = triangle.edges[i];
+        origin_x[i] = _mm_set1_ps(edge.origin.x);
+        delta_y[i] = _mm_set1_ps(edge.delta.y);
+        sign[i] = _mm_set1_ps(edge.sign);
+        top_left[i] = _mm_castsi128_ps(_mm_set1_epi32(edge.top_left ? -1 : 0));
+    }
+
+    alignas(16) float weights[3][SIMD_WIDTH];
+
+    for (int32_t y{rect.y}; y < rect.w; y++) {
+        float pixel_y = static_cast<float>(y) + 0.5f;
+        __m128 row_term[3];
+
+        for (size_t i{0}; i < 3; i++) {
+            const auto& edge = triangle.edges[i];
+            row_term[i] = _mm_set1_ps((pixel_y - edge.origin.y) * edge.delta.x);
+        }
+
+        for (int32_t x{rect.x}; x < rect.z; x += SIMD_WIDTH) {
+            __m128 pixel_x = _mm_add_ps(_mm_set1_ps(static_cast<float>(x)), lane_offsets);
+            __m128 mask = _mm_cmplt_ps(pixel_x, x_end);
+
+            for (size_t i{0}; i < 3; i++) {
+                __m128 value = _mm_mul_ps(_mm_sub_ps(pixel_x, origin_x[i]), delta_y[i]);
+                value = _mm_mul_ps(_mm_sub_ps(value, row_term[i]), sign[i]);
+
+                __m128 inside = _mm_or_ps(
+                    _mm_cmpgt_ps(value, zero),
+                    _mm_and_ps(_mm_cmpeq_ps(value, zero), top_left[i]));
+                mask = _mm_and_ps(mask, inside);
+                _mm_store_ps(weights[i], value);
+            }
+
+            int coverage = _mm_movemask_ps(mask);
+
+            for (int32_t lane{0}; coverage != 0; lane++, coverage >>= 1) {
+                if ((coverage & 1) != 0) {
+                    float pixel_weights[3] = {weights[0][lane], weights[1][lane],
+                                              weights[2][lane]};
+                    shadePixel(target, triangle, x + lane, y, pixel_weights);
+                }
+            }
+        }
+    }
+}
+
+#else
+
+void Rasterizer::rasterizeTriangle(const target_t& target, const triangle_t& triangle,
+                                   const glm::ivec4& rect) const
+{
+    for (int32_t y{rect.y}; y < rect.w; y++) {
+        float pixel_y = static_cast<float>(y) + 0.5f;
+
+        for (int32_t x{rect.x}; x < rect.z; x++) {
+            float pixel_x = static_cast<float>(x) + 0.5f;
+            float weights[3]{};
+            bool inside{true};
+
+            for (size_t i{0}; i < 3 && inside; i++) {
+                const auto& edge = triangle.edges[i];
+                weights[i] =
+                    edge.sign * edgeFunction(edge.origin, edge.delta, pixel_x, pixel_y);
+                inside = weights[i] > 0.0f || (weights[i] == 0.0f && edge.top_left);
+            }
+
+            if (inside) {
+                shadePixel(target, triangle, x, y, weights);
+            }
+        }
+    }
+}
+
+#endif
+
+void Rasterizer::shadePixel(const target_t& target, const triangle_t& triangle,
+                            int32_t x, int32_t y, const float* weights) const
+{
+    float weight_sum = weights[0] + weights[1] + weights[2];
+    glm::vec3 bary = glm::vec3{weights[0], weights[1], weights[2]} / weight_sum;
+
+    float depth = bary[0] * triangle.depth[0] + bary[1] * triangle.depth[1] +
+                  bary[2] * triangle.depth[2];
+    size_t pixel_idx = static_cast<size_t>(y) * target.width + x;
+
+    if (depth < 0.0f || depth > 1.0f || !(depth < target.depth[pixel_idx])) {
+        return;
+    }
+
+    float inv_w = bary[0] * triangle.inv_w[0] + bary[1] * triangle.inv_w[1] +
+                  bary[2] * triangle.inv_w[2];
+    float w = 1.0f / inv_w;
+
+    glm::vec4 color = (bary[0] * triangle.color_w[0] + bary[1] * triangle.color_w[1] +
+                       bary[2] * triangle.color_w[2]) *
+                      w;
+
+    if (triangle.texture != nullptr) {
+        glm::vec2 tex_coord = (bary[0] * triangle.tex_coord_w[0] +
+                               bary[1] * triangle.tex_coord_w[1] +
+                               bary[2] * triangle.tex_coord_w[2]) *
+                              w;
+        color *= sampleTexture(*triangle.texture, tex_coord * triangle.tiling_factor);
+    }
+
+    color = glm::clamp(color, 0.0f, 1.0f);
+    glm::vec4 dst_color = toColor(target.color[pixel_idx]);
+    color = color * color.a + dst_color * (1.0f - color.a);
+
+    target.color[pixel_idx] = toRGBA8(color);
+    target.depth[pixel_idx] = depth;
+}
+
+} // namespace GE::Headless
@@ -0,0 +1,125 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// NOLINTNEXTLINE
+#ifndef GE_RENDERER_HEADLESS_RASTERIZER_H_
+#define GE_RENDERER_HEADLESS_RASTERIZER_H_
+
+#include "device.h"
+
+#include "ge/thread_pool.h"
+
+#include <glm/glm.hpp>
+
+#include <vector>
+
+namespace GE::Headless {
+
+// Rasterizes indexed triangle lists into RGBA8 color and float depth buffers.
+// The target is split into tiles which are processed in parallel, triangles
+// inside of a tile are rasterized in submission order, so the result doesn't
+// depend on the number of threads. The pipeline mirrors the state set up by
+// the OpenGL context: depth test LESS with depth writes and
+// SRC_ALPHA/ONE_MINUS_SRC_ALPHA blending. Textures are sampled with the
+// nearest filter and repeat wrapping.
+class Rasterizer
+{
+public:
+    struct vertex_t {
+        glm::vec4 position{0.0f, 0.0f, 0.0f, 1.0f};
+        glm::vec4 color{1.0f};
+        glm::vec2 tex_coord{0.0f};
+        float tex_index{0.0f};
+        float tiling_factor{1.0f};
+    };
+
+    struct target_t {
+        uint32_t* color{nullptr};
+        float* depth{nullptr};
+        uint32_t width{};
+        uint32_t height{};
+        glm::uvec4 viewport{0};
+    };
+
+    explicit Rasterizer(uint32_t threads_num);
+
+    void draw(const target_t& target, const std::vector<vertex_t>& vertices,
+              const uint32_t* indexes, uint32_t index_count,
+              const Device::TextureSlots& textures);
+
+private:
+    struct edge_t {
+        glm::vec2 origin{0.0f};
+        glm::vec2 delta{0.0f};
+        float sign{1.0f};
+        bool top_left{false};
+    };
+
+    struct triangle_t {
+        edge_t edges[3];
+        glm::vec4 color_w[3];
+        glm::vec2 tex_coord_w[3];
+        float depth[3]{};
+        float inv_w[3]{};
+        float tiling_factor{1.0f};
+        const Texture2D* texture{nullptr};
+        glm::ivec4 bbox{0};
+    };
+
+    struct tile_t {
+        const Rasterizer* rasterizer{nullptr};
+        const target_t* target{nullptr};
+        const std::vector<uint32_t>* bin{nullptr};
+        uint32_t x{};
+        uint32_t y{};
+    };
+
+    bool setupTriangle(const target_t& target, const vertex_t& v0, const vertex_t& v1,
+                       const vertex_t& v2, const Device::TextureSlots& textures,
+                       triangle_t* triangle) const;
+    void binTriangles(uint32_t tiles_x, uint32_t tiles_y);
+    void rasterizeTile(const target_t& target, uint32_t tile_x, uint32_t tile_y,
+                       const std::vector<uint32_t>& bin) const;
+    void rasterizeTriangle(const target_t& target, const triangle_t& triangle,
+                           const glm::ivec4& rect) const;
+    void shadePixel(const target_t& target, const triangle_t& triangle, int32_t x,
+                    int32_t y, const float* weights) const;
+
+    ThreadPool m_thread_pool{"Rasterizer"};
+    uint32_t m_threads_num{};
+    std::vector<triangle_t> m_triangles;
+    std::vector<std::vector<uint32_t>> m_bins;
+};
+
+} // namespace GE::Headless
+
+#endif // GE_RENDERER_HEADLESS_RASTERIZER_H_
@@ -0,0 +1,151 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "shader_program.h"
+#include "device.h"
+
+#include "ge/core/asserts.h"
+#include "ge/debug/profile.h"
+
+namespace GE::Headless {
+
+ShaderProgram::ShaderProgram(std::string name)
+    : m_name(std::move(name))
+{}
+
+ShaderProgram::~ShaderProgram()
+{
+    Device::release(this);
+}
+
+void ShaderProgram::addShader(Shared<::GE::Shader> shader)
+{
+    GE_PROFILE_FUNC();
+
+    m_shaders.emplace_back(std::move(shader));
+}
+
+void ShaderProgram::addShaders(std::initializer_list<Shared<::GE::Shader>> shaders)
+{
+    GE_PROFILE_FUNC();
+
+    std::move(shaders.begin(), shaders.end(), std::back_inserter(m_shaders));
+}
+
+bool ShaderProgram::link()
+{
+    GE_PROFILE_FUNC();
+
+    GE_CORE_ASSERT_MSG(!m_shaders.empty(), "There are no shaders to link");
+    clear();
+    return true;
+}
+
+void ShaderProgram::clear()
+{
+    GE_PROFILE_FUNC();
+
+    m_shaders.clear();
+}
+
+void ShaderProgram::setUniformInt(const std::string& name, int value)
+{
+    GE_PROFILE_FUNC();
+
+    m_uniforms[name] = value;
+}
+
+void ShaderProgram::setUniformIntArray(const std::string& name, const int* array,
+                                       uint32_t count)
+{
+    GE_PROFILE_FUNC();
+
+    m_uniforms[name] = std::vector<int>(array, array + count);
+}
+
+void ShaderProgram::setUniformFloat(const std::string& name, float value)
+{
+    GE_PROFILE_FUNC();
+
+    m_uniforms[name] = value;
+}
+
+void ShaderProgram::setUniformFloat2(const std::string& name, const glm::vec2& vector)
+{
+    GE_PROFILE_FUNC();
+
+    m_uniforms[name] = vector;
+}
+
+void ShaderProgram::setUniformFloat3(const std::string& name, const glm::vec3& vector)
+{
+    GE_PROFILE_FUNC();
+
+    m_uniforms[name] = vector;
+}
+
+void ShaderProgram::setUniformFloat4(const std::string& name, const glm::vec4& vector)
+{
+    GE_PROFILE_FUNC();
+
+    m_uniforms[name] = vector;
+}
+
+void ShaderProgram::setUniformMat3(const std::string& name, const glm::mat3& matrix)
+{
+    GE_PROFILE_FUNC();
+
+    m_uniforms[name] = matrix;
+}
+
+void ShaderProgram::setUniformMat4(const std::string& name, const glm::mat4& matrix)
+{
+    GE_PROFILE_FUNC();
+
+    m_uniforms[name] = matrix;
+}
+
+void ShaderProgram::bind() const
+{
+    GE_PROFILE_FUNC();
+
+    Device::bindShaderProgram(this);
+}
+
+void ShaderProgram::unbind() const
+{
+    GE_PROFILE_FUNC();
+
+    Device::bindShaderProgram(nullptr);
+}
+
+} // namespace GE::Headless
@@ -0,0 +1,218 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "software_renderer_api.h"
+#include "buffers.h"
+#include "framebuffer.h"
+#include "shader_program.h"
+#include "vertex_array.h"
+
+#include "ge/core/log.h"
+#include "ge/debug/profile.h"
+#include "ge/renderer/renderer.h"
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+#include <unordered_map>
+
+namespace {
+
+using Vertex = GE::Headless::Rasterizer::vertex_t;
+
+enum class Attribute : uint8_t
+{
+    POS = 0,
+    COLOR,
+    TEX_COORD,
+    TEX_INDEX,
+    TILING_FACTOR,
+    UNKNOWN
+};
+
+Attribute toAttribute(const std::string& name)
+{
+    static const std::unordered_map<std::string, Attribute> name_to_attribute{
+        {GE::Attributes::POS, Attribute::POS},
+        {GE::Attributes::COLOR, Attribute::COLOR},
+        {GE::Attributes::TEX_COORD, Attribute::TEX_COORD},
+        {GE::Attributes::TEX_INDEX, Attribute::TEX_INDEX},
+        {GE::Attributes::TILING_FACTOR, Attribute::TILING_FACTOR}};
+
+    auto attribute = name_to_attribute.find(name);
+    return attribute != name_to_attribute.end() ? attribute->second : Attribute::UNKNOWN;
+}
+
+uint32_t getComponentCount(Attribute attribute)
+{
+    switch (attribute) {
+        case Attribute::POS: return 3;
+        case Attribute::COLOR: return 4;
+        case Attribute::TEX_COORD: return 2;
+        case Attribute::TEX_INDEX:
+        case Attribute::TILING_FACTOR: return 1;
+        default: return 0;
+    }
+}
+
+float* getAttributeData(Vertex* vertex, Attribute attribute)
+{
+    switch (attribute) {
+        case Attribute::POS: return &vertex->position.x;
+        case Attribute::COLOR: return &vertex->color.x;
+        case Attribute::TEX_COORD: return &vertex->tex_coord.x;
+        case Attribute::TEX_INDEX: return &vertex->tex_index;
+        case Attribute::TILING_FACTOR: return &vertex->tiling_factor;
+        default: return nullptr;
+    }
+}
+
+bool isFloatElement(GE::BufferElement::Type type)
+{
+    return type == GE_ELEMENT_FLOAT || type == GE_ELEMENT_FLOAT2 ||
+           type == GE_ELEMENT_FLOAT3 || type == GE_ELEMENT_FLOAT4;
+}
+
+} // namespace
+
+namespace GE::Headless {
+
+SoftwareRendererAPI::SoftwareRendererAPI(API api)
+    : RendererAPI{api}
+    , m_rasterizer{std::max(std::thread::hardware_concurrency(), 1u)}
+{}
+
+void SoftwareRendererAPI::draw(uint32_t index_count)
+{
+    GE_PROFILE_FUNC();
+
+    // Rejected draws are neither asserted by the base nor counted in the stats
+    const auto* vertex_array = Device::getVertexArray();
+
+    if (vertex_array == nullptr || vertex_array->getIndexBuffer() == nullptr) {
+        GE_CORE_ERR_PER_SEC(1, "Failed to draw: no vertex array with indexes is bound");
+        return;
+    }
+
+    const auto* index_buffer =
+        static_cast<const IndexBuffer*>(vertex_array->getIndexBuffer().get());
+
+    if (index_count > index_buffer->getCount()) {
+        GE_CORE_ERR_PER_SEC(1, "Failed to draw: {} indexes requested, {} are bound",
+                            index_count, index_buffer->getCount());
+        return;
+    }
+
+    RendererAPI::draw(index_count);
+
+    auto* framebuffer = Device::getFramebuffer();
+
+    if (framebuffer == nullptr || index_count == 0) {
+        return;
+    }
+
+    const uint32_t* indexes = index_buffer->data();
+    uint32_t vertex_count = *std::max_element(indexes, indexes + index_count) + 1;
+
+    fetchVertices(*vertex_array, vertex_count);
+
+    Rasterizer::target_t target{};
+    target.color = framebuffer->getColorAttachment();
+    target.depth = framebuffer->getDepthAttachment();
+    target.width = framebuffer->getProps().width;
+    target.height = framebuffer->getProps().height;
+    target.viewport = Device::getViewport();
+
+    m_rasterizer.draw(target, m_vertices, indexes, index_count, Device::getTextures());
+}
+
+void SoftwareRendererAPI::fetchVertices(const VertexArray& vertex_array,
+                                        uint32_t vertex_count)
+{
+    GE_PROFILE_FUNC();
+
+    glm::mat4 mvp{1.0f};
+    Vertex default_vertex{};
+
+    if (const auto* shader_program = Device::getShaderProgram();
+        shader_program != nullptr) {
+        if (const auto* vp = shader_program->getUniform<glm::mat4>(Uniforms::VP_MATRIX)) {
+            mvp = *vp;
+        }
+
+        if (const auto* transform =
+                shader_program->getUniform<glm::mat4>(Uniforms::TRANSFORM)) {
+            mvp = mvp * *transform;
+        }
+
+        if (const auto* color = shader_program->getUniform<glm::vec4>(Uniforms::COLOR)) {
+            default_vertex.color = *color;
+        }
+    }
+
+    m_vertices.assign(vertex_count, default_vertex);
+
+    for (const auto& buffer : vertex_array.getVertexBuffers()) {
+        const auto* vertex_buffer = static_cast<const VertexBuffer*>(buffer.get());
+        const auto& layout = vertex_buffer->getLayout();
+        uint32_t stride = layout.getStride();
+
+        if (stride == 0) {
+            continue;
+        }
+
+        uint32_t count = std::min(vertex_count, vertex_buffer->size() / stride);
+
+        for (const auto& element : layout) {
+            Attribute attribute = toAttribute(element.name());
+
+            if (attribute == Attribute::UNKNOWN || !isFloatElement(element.type())) {
+                continue;
+            }
+
+            uint32_t components =
+                std::min(element.getComponentCount(), getComponentCount(attribute));
+            const uint8_t* src = vertex_buffer->data() + element.offset();
+
+            for (uint32_t i{0}; i < count; i++, src += stride) {
+                std::memcpy(getAttributeData(&m_vertices[i], attribute), src,
+                            components * sizeof(float));
+            }
+        }
+    }
+
+    for (auto& vertex : m_vertices) {
+        vertex.position = mvp * vertex.position;
+    }
+}
+
+} // namespace GE::Headless
@@ -0,0 +1,64 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// NOLINTNEXTLINE
+#ifndef GE_RENDERER_HEADLESS_SOFTWARE_RENDERER_API_H_
+#define GE_RENDERER_HEADLESS_SOFTWARE_RENDERER_API_H_
+
+#include "rasterizer.h"
+#include "renderer_api.h"
+
+namespace GE::Headless {
+
+// Shares the objects of the headless backend, but actually rasterizes draw
+// calls into the color attachment of the bound framebuffer. The vertex stage
+// implements the Renderer2D texture shader: a position is transformed by
+// 'u_ViewProjection' and 'u_Transform', a fragment color is the vertex color
+// modulated by the texture from the 'a_TexIndex' slot.
+class SoftwareRendererAPI: public RendererAPI
+{
+public:
+    explicit SoftwareRendererAPI(API api);
+
+    using RendererAPI::draw;
+    void draw(uint32_t index_count) override;
+
+private:
+    void fetchVertices(const VertexArray& vertex_array, uint32_t vertex_count);
+
+    Rasterizer m_rasterizer;
+    std::vector<Rasterizer::vertex_t> m_vertices;
+};
+
+} // namespace GE::Headless
+
+#endif // GE_RENDERER_HEADLESS_SOFTWARE_RENDERER_API_H_
@@ -0,0 +1,104 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "texture.h"
+#include "device.h"
+
+#include "ge/core/asserts.h"
+#include "ge/debug/profile.h"
+
+#include <stb_image.h>
+
+#include <cstring>
+
+#define DESIRED_CHANNELS_NONE 0
+
+namespace GE::Headless {
+
+Texture2D::Texture2D(std::string path)
+    : m_path{std::move(path)}
+    , m_id{Device::generateID()}
+{
+    GE_PROFILE_FUNC();
+
+    int width{};
+    int height{};
+    int channels{};
+    stbi_uc* data{nullptr};
+
+    {
+        GE_PROFILE_SCOPE("Headless::Texture2D Load Texture");
+        stbi_set_flip_vertically_on_load(1);
+        data =
+            stbi_load(m_path.c_str(), &width, &height, &channels, DESIRED_CHANNELS_NONE);
+        GE_CORE_ASSERT_MSG(data, "Failed to load texture '{}'", m_path);
+    }
+
+    m_width = width;
+    m_height = height;
+    m_bpp = channels;
+    m_data.assign(data, data + m_width * m_height * m_bpp);
+    stbi_image_free(data);
+}
+
+Texture2D::Texture2D(uint32_t width, uint32_t height, uint32_t bpp)
+    : m_id{Device::generateID()}
+    , m_width{width}
+    , m_height{height}
+    , m_bpp{bpp}
+    , m_data(width * height * bpp)
+{
+    GE_PROFILE_FUNC();
+}
+
+Texture2D::~Texture2D()
+{
+    Device::release(this);
+}
+
+void Texture2D::setData(const void* data, uint32_t size)
+{
+    GE_PROFILE_FUNC();
+
+    GE_CORE_ASSERT_MSG(size == m_data.size(), "Wrong texture size: {} != {}", size,
+                       m_data.size());
+    std::memcpy(m_data.data(), data, size);
+}
+
+void Texture2D::bind(uint32_t slot) const
+{
+    GE_PROFILE_FUNC();
+
+    Device::bindTexture(slot, this);
+}
+
+} // namespace GE::Headless
@@ -0,0 +1,76 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "vertex_array.h"
+#include "device.h"
+
+#include "ge/core/asserts.h"
+#include "ge/debug/profile.h"
+
+namespace GE::Headless {
+
+VertexArray::~VertexArray()
+{
+    Device::release(this);
+}
+
+void VertexArray::bind() const
+{
+    GE_PROFILE_FUNC();
+
+    Device::bindVertexArray(this);
+}
+
+void VertexArray::unbind() const
+{
+    GE_PROFILE_FUNC();
+
+    Device::bindVertexArray(nullptr);
+}
+
+void VertexArray::addVertexBuffer(Shared<::GE::VertexBuffer> vertex_buffer)
+{
+    GE_PROFILE_FUNC();
+
+    const auto& layout = vertex_buffer->getLayout();
+    GE_CORE_ASSERT_MSG(!layout.getElements().empty(), "Vertex Buffer has no layout");
+    m_vertices.emplace_back(std::move(vertex_buffer));
+}
+
+void VertexArray::setIndexBuffer(Shared<::GE::IndexBuffer> index_buffer)
+{
+    GE_PROFILE_FUNC();
+
+    m_index_buffer = std::move(index_buffer);
+}
+
+} // namespace GE::Headless
@@ -0,0 +1,63 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// NOLINTNEXTLINE
+#ifndef GE_RENDERER_HEADLESS_VERTEX_ARRAY_H_
+#define GE_RENDERER_HEADLESS_VERTEX_ARRAY_H_
+
+#include "ge/renderer/vertex_array.h"
+
+namespace GE::Headless {
+
+class VertexArray: public ::GE::VertexArray
+{
+public:
+    VertexArray() = default;
+    ~VertexArray() override;
+
+    void bind() const override;
+    void unbind() const override;
+
+    void addVertexBuffer(Shared<::GE::VertexBuffer> vertex_buffer) override;
+    void setIndexBuffer(Shared<::GE::IndexBuffer> index_buffer) override;
+
+    const Vertices& getVertexBuffers() const override { return m_vertices; }
+    Shared<::GE::IndexBuffer> getIndexBuffer() const override { return m_index_buffer; }
+
+private:
+    Vertices m_vertices;
+    Shared<::GE::IndexBuffer> m_index_buffer;
+};
+
+} // namespace GE::Headless
+
+#endif // GE_RENDERER_HEADLESS_VERTEX_ARRAY_H_
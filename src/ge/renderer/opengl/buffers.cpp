@@ -33,7 +33,9 @@
 #include "buffers.h"
 #include "opengl_utils.h"
 
+#include "ge/debug/counters.h"
 #include "ge/debug/profile.h"
+#include "ge/renderer/render_thread.h"
 
 #include <glad/glad.h>
 
@@ -75,6 +77,7 @@ BufferBase::BufferBase(Type type, const void* data, uint32_t size, Usage usage)
     : m_gl_type{toGLBufferType(type)}
 {
     GE_PROFILE_FUNC();
+    GE_ASSERT_CONTEXT_THREAD();
 
     GE_CORE_ASSERT_MSG(m_gl_type, "Unknown buffer type");
     GLCall(glCreateBuffers(1, &m_id));
@@ -109,6 +112,7 @@ void BufferBase::setBufferData(const void* data, uint32_t size) const
 
     GLCall(glBindBuffer(m_gl_type, m_id));
     GLCall(glBufferSubData(m_gl_type, 0, size, data));
+    GE_COUNTER("Bytes uploaded", size);
 }
 
 } // namespace GE::OpenGL
@@ -35,6 +35,7 @@
 
 #include "ge/core/log.h"
 #include "ge/debug/profile.h"
+#include "ge/renderer/render_thread.h"
 
 #include <glad/glad.h>
 
@@ -44,6 +45,7 @@ Framebuffer::Framebuffer(const GE::Framebuffer::properties_t& props)
     : m_props{props}
 {
     GE_PROFILE_FUNC();
+    GE_ASSERT_CONTEXT_THREAD();
 
     create();
 }
@@ -75,7 +77,8 @@ void Framebuffer::resize(const glm::vec2& size)
     GE_PROFILE_FUNC();
 
     if (size.x <= 0 || size.y <= 0) {
-        GE_CORE_ERR("Attempted to resize framebuffer to ({}, {})", size.x, size.y);
+        GE_CORE_ERR_CAT(RENDERER, "Attempted to resize framebuffer to ({}, {})", size.x,
+                        size.y);
         return;
     }
 
@@ -85,6 +88,17 @@ void Framebuffer::resize(const glm::vec2& size)
     create();
 }
 
+std::vector<uint32_t> Framebuffer::readColorAttachment() const
+{
+    GE_PROFILE_FUNC();
+
+    std::vector<uint32_t> pixels(m_props.width * m_props.height);
+    GLsizei buffer_size = pixels.size() * sizeof(uint32_t);
+    GLCall(glGetTextureImage(m_color_attachment_id, 0, GL_RGBA, GL_UNSIGNED_BYTE,
+                             buffer_size, pixels.data()));
+    return pixels;
+}
+
 void Framebuffer::create()
 {
     GE_PROFILE_FUNC();
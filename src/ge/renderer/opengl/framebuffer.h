@@ -52,6 +52,8 @@ public:
     uint32_t getColorAttachmentID() const override { return m_color_attachment_id; }
     const properties_t& getProps() const override { return m_props; }
 
+    std::vector<uint32_t> readColorAttachment() const override;
+
 private:
     void create();
     void release();
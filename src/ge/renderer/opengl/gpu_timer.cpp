@@ -0,0 +1,142 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "gpu_timer.h"
+#include "opengl_utils.h"
+
+#include "ge/core/log.h"
+#include "ge/renderer/render_thread.h"
+
+#include <glad/glad.h>
+
+#define SCOPES_RING_SIZE   256
+#define CALIBRATION_PERIOD 1.0
+
+namespace GE::OpenGL {
+
+GpuTimer::GpuTimer()
+    : m_scopes(SCOPES_RING_SIZE)
+{
+    GE_ASSERT_CONTEXT_THREAD();
+
+    std::vector<GLuint> queries(m_scopes.size() * 2);
+    GLCall(glCreateQueries(GL_TIMESTAMP, queries.size(), queries.data()));
+
+    for (size_t i{0}; i < m_scopes.size(); i++) {
+        m_scopes[i].start_query = queries[i * 2];
+        m_scopes[i].end_query = queries[i * 2 + 1];
+    }
+
+    calibrate();
+}
+
+GpuTimer::~GpuTimer()
+{
+    for (const auto& scope : m_scopes) {
+        GLCall(glDeleteQueries(1, &scope.start_query));
+        GLCall(glDeleteQueries(1, &scope.end_query));
+    }
+}
+
+bool GpuTimer::begin(const char* name)
+{
+    if (m_in_flight_count == m_scopes.size()) {
+        m_dropped_count++;
+        return false;
+    }
+
+    auto& scope = m_scopes[m_head];
+    scope.name = name;
+    scope.ended = false;
+    GLCall(glQueryCounter(scope.start_query, GL_TIMESTAMP));
+
+    m_open_scopes.push_back(m_head);
+    m_head = (m_head + 1) % m_scopes.size();
+    m_in_flight_count++;
+    return true;
+}
+
+void GpuTimer::end()
+{
+    GE_CORE_ASSERT_MSG(!m_open_scopes.empty(), "There is no GPU timer scope to end");
+
+    auto& scope = m_scopes[m_open_scopes.back()];
+    m_open_scopes.pop_back();
+    GLCall(glQueryCounter(scope.end_query, GL_TIMESTAMP));
+    scope.ended = true;
+}
+
+void GpuTimer::collect(Samples* samples)
+{
+    if (Timestamp::now() - m_calibration_time > CALIBRATION_PERIOD) {
+        calibrate();
+    }
+
+    for (; m_in_flight_count > 0; m_in_flight_count--) {
+        const auto& scope = m_scopes[m_tail];
+        GLint available{GL_FALSE};
+
+        if (!scope.ended) {
+            break;
+        }
+
+        GLCall(
+            glGetQueryObjectiv(scope.end_query, GL_QUERY_RESULT_AVAILABLE, &available));
+
+        if (available == GL_FALSE) {
+            break;
+        }
+
+        GLuint64 start_ns{};
+        GLuint64 end_ns{};
+        GLCall(glGetQueryObjectui64v(scope.start_query, GL_QUERY_RESULT, &start_ns));
+        GLCall(glGetQueryObjectui64v(scope.end_query, GL_QUERY_RESULT, &end_ns));
+
+        Timestamp start = static_cast<double>(start_ns) / GE_NS_IN_SEC;
+        Timestamp elapsed_time = static_cast<double>(end_ns - start_ns) / GE_NS_IN_SEC;
+        samples->push_back({scope.name, start + m_gpu_to_cpu_offset, elapsed_time});
+
+        m_tail = (m_tail + 1) % m_scopes.size();
+    }
+}
+
+void GpuTimer::calibrate()
+{
+    GLint64 gpu_time_ns{};
+    GLCall(glGetInteger64v(GL_TIMESTAMP, &gpu_time_ns));
+
+    Timestamp gpu_time = static_cast<double>(gpu_time_ns) / GE_NS_IN_SEC;
+    m_calibration_time = Timestamp::now();
+    m_gpu_to_cpu_offset = m_calibration_time - gpu_time;
+}
+
+} // namespace GE::OpenGL
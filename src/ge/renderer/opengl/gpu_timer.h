@@ -0,0 +1,79 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// NOLINTNEXTLINE
+#ifndef GE_RENDERER_OPENGL_GPU_TIMER_H_
+#define GE_RENDERER_OPENGL_GPU_TIMER_H_
+
+#include <ge/renderer/gpu_timer.h>
+
+namespace GE::OpenGL {
+
+// Every scope takes a pair of GL_TIMESTAMP queries from a ring. Queries are
+// completed by the GPU in order, so collect() reads them from the oldest one
+// and stops at the first result which isn't available yet. If all of the
+// queries are in flight, the scope is dropped instead of waiting for the GPU.
+class GpuTimer: public ::GE::GpuTimer
+{
+public:
+    GpuTimer();
+    ~GpuTimer() override;
+
+    bool begin(const char* name) override;
+    void end() override;
+    void collect(Samples* samples) override;
+
+    uint64_t getDroppedCount() const override { return m_dropped_count; }
+
+private:
+    struct scope_t {
+        const char* name{nullptr};
+        uint32_t start_query{};
+        uint32_t end_query{};
+        bool ended{false};
+    };
+
+    void calibrate();
+
+    std::vector<scope_t> m_scopes;
+    std::vector<size_t> m_open_scopes;
+    size_t m_head{0};
+    size_t m_tail{0};
+    size_t m_in_flight_count{0};
+    uint64_t m_dropped_count{0};
+    Timestamp m_gpu_to_cpu_offset;
+    Timestamp m_calibration_time;
+};
+
+} // namespace GE::OpenGL
+
+#endif // GE_RENDERER_OPENGL_GPU_TIMER_H_
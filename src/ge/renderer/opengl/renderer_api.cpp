@@ -71,6 +71,7 @@ void RendererAPI::clear(const glm::vec4& color)
 
     GLCall(glClearColor(color.r, color.g, color.b, color.a));
     GLCall(glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT));
+    m_stats.clear_count++;
 }
 
 void RendererAPI::draw(const Shared<VertexArray>& vertex_array)
@@ -86,6 +87,8 @@ void RendererAPI::draw(uint32_t index_count)
     GE_PROFILE_FUNC();
 
     GLCall(glDrawElements(GL_TRIANGLES, index_count, GL_UNSIGNED_INT, nullptr));
+    m_stats.draw_calls_count++;
+    m_stats.index_count += index_count;
 }
 
 void RendererAPI::setViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height)
@@ -36,6 +36,7 @@
 #include "ge/core/asserts.h"
 #include "ge/core/log.h"
 #include "ge/debug/profile.h"
+#include "ge/renderer/render_thread.h"
 
 #include <glad/glad.h>
 
@@ -79,6 +80,7 @@ Shader::Shader(Type type)
     : m_type{toGlType(type)}
 {
     GE_PROFILE_FUNC();
+    GE_ASSERT_CONTEXT_THREAD();
 
     GLCall(m_id = glCreateShader(m_type));
 }
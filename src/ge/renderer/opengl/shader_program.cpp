@@ -36,6 +36,7 @@
 #include "ge/core/asserts.h"
 #include "ge/core/log.h"
 #include "ge/debug/profile.h"
+#include "ge/renderer/render_thread.h"
 
 #include <glad/glad.h>
 #include <glm/gtc/type_ptr.hpp>
@@ -46,6 +47,7 @@ ShaderProgram::ShaderProgram(std::string name)
     : m_name(std::move(name))
 {
     GE_PROFILE_FUNC();
+    GE_ASSERT_CONTEXT_THREAD();
 
     GLCall(m_id = glCreateProgram());
 }
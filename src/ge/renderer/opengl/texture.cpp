@@ -33,7 +33,9 @@
 #include "texture.h"
 #include "opengl_utils.h"
 
+#include "ge/debug/counters.h"
 #include "ge/debug/profile.h"
+#include "ge/renderer/render_thread.h"
 
 #include <glad/glad.h>
 #include <stb_image.h>
@@ -62,6 +64,7 @@ Texture2D::Texture2D(std::string path)
     : m_path{std::move(path)}
 {
     GE_PROFILE_FUNC();
+    GE_ASSERT_CONTEXT_THREAD();
 
     int width{};
     int height{};
@@ -93,6 +96,7 @@ Texture2D::Texture2D(uint32_t width, uint32_t height, uint32_t bpp)
     , m_bpp(bpp)
 {
     GE_PROFILE_FUNC();
+    GE_ASSERT_CONTEXT_THREAD();
 
     auto [internal_format, data_format] = toGLFormats(m_bpp);
     createTexture(internal_format);
@@ -113,6 +117,7 @@ void Texture2D::setData(const void* data, uint32_t size)
     auto [internal_format, data_format] = toGLFormats(m_bpp);
     GLCall(glTextureSubImage2D(m_id, 0, 0, 0, m_width, m_height, data_format,
                                GL_UNSIGNED_BYTE, data));
+    GE_COUNTER("Bytes uploaded", size);
 }
 
 void Texture2D::bind(uint32_t slot) const
@@ -120,6 +125,7 @@ void Texture2D::bind(uint32_t slot) const
     GE_PROFILE_FUNC();
 
     GLCall(glBindTextureUnit(slot, m_id));
+    GE_COUNTER("Textures bound", 1);
 }
 
 void Texture2D::createTexture(uint32_t internal_format)
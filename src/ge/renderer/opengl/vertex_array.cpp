@@ -34,6 +34,7 @@
 #include "opengl_utils.h"
 
 #include "ge/debug/profile.h"
+#include "ge/renderer/render_thread.h"
 
 #include <glad/glad.h>
 
@@ -67,6 +68,7 @@ namespace GE::OpenGL {
 VertexArray::VertexArray()
 {
     GE_PROFILE_FUNC();
+    GE_ASSERT_CONTEXT_THREAD();
 
     GLCall(glCreateVertexArrays(1, &m_id));
 }
@@ -107,9 +107,14 @@ void OrthoCameraController::onEvent(Event *event)
 {
     GE_PROFILE_FUNC();
 
-    EventDispatcher dispatcher{event};
-    dispatcher.dispatch<MouseScrolledEvent>(GE_BIND_EVENT_FN(onMouseScrolled));
-    dispatcher.dispatch<WindowResizedEvent>(GE_BIND_EVENT_FN(onWindowResizedEvent));
+    static const auto handlers = [] {
+        EventHandlerTable<OrthoCameraController> handlers;
+        handlers.add<MouseScrolledEvent, &OrthoCameraController::onMouseScrolled>();
+        handlers.add<WindowResizedEvent, &OrthoCameraController::onWindowResizedEvent>();
+        return handlers;
+    }();
+
+    handlers.dispatch(event, this);
 }
 
 void OrthoCameraController::resize(const glm::vec2 &size)
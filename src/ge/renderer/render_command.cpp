@@ -31,6 +31,7 @@
  */
 
 #include "render_command.h"
+#include "render_thread.h"
 
 #include "ge/core/log.h"
 
@@ -58,21 +59,25 @@ void RenderCommand::shutdown()
 
 void RenderCommand::clear(const glm::vec4& color)
 {
+    GE_ASSERT_CONTEXT_THREAD();
     get()->m_renderer_api->clear(color);
 }
 
 void RenderCommand::draw(const Shared<VertexArray>& vertex_array)
 {
+    GE_ASSERT_CONTEXT_THREAD();
     get()->m_renderer_api->draw(vertex_array);
 }
 
 void RenderCommand::draw(uint32_t index_count)
 {
+    GE_ASSERT_CONTEXT_THREAD();
     get()->m_renderer_api->draw(index_count);
 }
 
 void RenderCommand::setViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height)
 {
+    GE_ASSERT_CONTEXT_THREAD();
     get()->m_renderer_api->setViewport(x, y, width, height);
 }
 
@@ -86,4 +91,14 @@ const RendererAPI::capabilities_t& RenderCommand::getCapabilities()
     return get()->m_renderer_api->getCapabilities();
 }
 
+const RendererAPI::statistics_t& RenderCommand::getStats()
+{
+    return get()->m_renderer_api->getStats();
+}
+
+void RenderCommand::resetStats()
+{
+    get()->m_renderer_api->resetStats();
+}
+
 } // namespace GE
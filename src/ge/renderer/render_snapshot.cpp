@@ -0,0 +1,107 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "render_snapshot.h"
+#include "orthographic_camera.h"
+#include "texture.h"
+
+#include "ge/core/asserts.h"
+#include "ge/debug/profile.h"
+#include "ge/ecs/components.h"
+#include "ge/ecs/entity.h"
+
+namespace GE {
+
+void RenderSnapshot::setViewport(uint32_t width, uint32_t height)
+{
+    m_viewport_width = width;
+    m_viewport_height = height;
+}
+
+void RenderSnapshot::setClearColor(const glm::vec4& color)
+{
+    m_clear_color = color;
+    m_has_clear_color = true;
+}
+
+void RenderSnapshot::beginView(const glm::mat4& vp_matrix)
+{
+    m_views.push_back({vp_matrix, m_sprites.size(), m_sprites.size()});
+}
+
+void RenderSnapshot::beginView(const OrthographicCamera& camera)
+{
+    beginView(camera.getVPMatrix());
+}
+
+void RenderSnapshot::beginView(const Entity& camera)
+{
+    const auto& transform = camera.getComponent<TransformComponent>().getTransform();
+    const auto& scene_camera = camera.getComponent<CameraComponent>().camera;
+
+    beginView(scene_camera.getProjection() * glm::inverse(transform));
+}
+
+void RenderSnapshot::addSprite(const Entity& entity)
+{
+    sprite_t sprite{};
+    sprite.transform = entity.getComponent<TransformComponent>().getTransform();
+    sprite.color = entity.getComponent<SpriteRendererComponent>().color;
+
+    addSprite(std::move(sprite));
+}
+
+void RenderSnapshot::addSprite(const Renderer2D::quad_t& quad)
+{
+    addSprite(
+        sprite_t{quad.getTransform(), quad.color, quad.texture, quad.tiling_factor});
+}
+
+void RenderSnapshot::addSprite(sprite_t sprite)
+{
+    GE_CORE_ASSERT_MSG(!m_views.empty(), "A view must be begun before adding sprites");
+
+    m_sprites.push_back(std::move(sprite));
+    m_views.back().sprites_end = m_sprites.size();
+}
+
+void RenderSnapshot::clear()
+{
+    GE_PROFILE_FUNC();
+
+    m_has_clear_color = false;
+    m_interpolation_alpha = 1.0;
+    m_views.clear();
+    m_sprites.clear();
+}
+
+} // namespace GE
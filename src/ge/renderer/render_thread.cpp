@@ -0,0 +1,212 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "render_thread.h"
+#include "gpu_profiler.h"
+#include "render_command.h"
+#include "renderer_2d.h"
+
+#include "ge/core/log.h"
+#include "ge/debug/profile.h"
+#include "ge/window/window.h"
+
+#include <atomic>
+#include <vector>
+
+namespace {
+
+// The default ID means the render thread isn't running
+std::atomic<std::thread::id> g_context_thread_id;
+std::mutex g_context_tasks_mtx;
+std::vector<std::function<void()>> g_context_tasks;
+
+void runContextTasks()
+{
+    std::vector<std::function<void()>> tasks;
+
+    {
+        std::lock_guard lock{g_context_tasks_mtx};
+        tasks.swap(g_context_tasks);
+    }
+
+    for (auto& task : tasks) {
+        task();
+    }
+}
+
+} // namespace
+
+namespace GE {
+
+RenderThread::~RenderThread()
+{
+    stop();
+}
+
+bool RenderThread::start(Window* window)
+{
+    GE_PROFILE_FUNC();
+
+    if (isRunning()) {
+        GE_CORE_ERR("Render thread is already running");
+        return false;
+    }
+
+    GE_CORE_DBG("Start render thread");
+    m_window = window;
+    m_running = true;
+    m_pending = false;
+
+    // The context is made current on the render thread
+    m_window->releaseContext();
+    m_thread = std::thread{[this] { renderLoop(); }};
+    g_context_thread_id = m_thread.get_id();
+    return true;
+}
+
+void RenderThread::stop()
+{
+    GE_PROFILE_FUNC();
+
+    if (!isRunning()) {
+        return;
+    }
+
+    {
+        std::lock_guard lock{m_mtx};
+        m_running = false;
+    }
+
+    m_cv.notify_all();
+    m_thread.join();
+    g_context_thread_id = std::thread::id{};
+    m_window->makeContextCurrent();
+
+    // Textures of the snapshots are released while the context is current
+    runContextTasks();
+
+    for (auto& snapshot : m_snapshots) {
+        snapshot.clear();
+    }
+
+    GE_CORE_DBG("Render thread has been stopped");
+}
+
+bool RenderThread::isContextThread()
+{
+    auto thread_id = g_context_thread_id.load(std::memory_order_relaxed);
+    return thread_id == std::thread::id{} || thread_id == std::this_thread::get_id();
+}
+
+void RenderThread::runWithContext(std::function<void()> task)
+{
+    if (isContextThread()) {
+        task();
+        return;
+    }
+
+    std::lock_guard lock{g_context_tasks_mtx};
+    g_context_tasks.push_back(std::move(task));
+}
+
+void RenderThread::submit()
+{
+    GE_PROFILE_FUNC();
+
+    std::unique_lock lock{m_mtx};
+    m_cv.wait(lock, [this] { return !m_pending; });
+
+    m_render_idx = m_fill_idx;
+    m_fill_idx = (m_fill_idx + 1) % m_snapshots.size();
+    m_pending = true;
+
+    lock.unlock();
+    m_cv.notify_all();
+}
+
+void RenderThread::wait()
+{
+    GE_PROFILE_FUNC();
+
+    std::unique_lock lock{m_mtx};
+    m_cv.wait(lock, [this] { return !m_pending; });
+}
+
+void RenderThread::renderLoop()
+{
+    m_window->makeContextCurrent();
+    std::unique_lock lock{m_mtx};
+
+    while (true) {
+        // The submitted frame is rendered even if the thread is being stopped
+        m_cv.wait(lock, [this] { return m_pending || !m_running; });
+
+        if (!m_pending) {
+            break;
+        }
+
+        RenderSnapshot* snapshot = &m_snapshots[m_render_idx];
+        lock.unlock();
+        render(snapshot);
+        lock.lock();
+
+        m_pending = false;
+        m_cv.notify_all();
+    }
+
+    m_window->releaseContext();
+}
+
+void RenderThread::render(RenderSnapshot* snapshot)
+{
+    GE_PROFILE_FUNC();
+
+    runContextTasks();
+
+    if (snapshot->getViewportWidth() > 0 && snapshot->getViewportHeight() > 0) {
+        RenderCommand::setViewport(0, 0, snapshot->getViewportWidth(),
+                                   snapshot->getViewportHeight());
+    }
+
+    if (snapshot->hasClearColor()) {
+        RenderCommand::clear(snapshot->getClearColor());
+    }
+
+    Renderer2D::draw(*snapshot);
+    m_window->swapBuffers();
+    GE_PROFILE_GPU_COLLECT();
+
+    // Textures are released by the thread that owns the context
+    snapshot->clear();
+}
+
+} // namespace GE
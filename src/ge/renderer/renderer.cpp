@@ -31,11 +31,13 @@
  */
 
 #include "renderer.h"
+#include "gpu_profiler.h"
 #include "render_command.h"
 #include "vertex_array.h"
 
 #include "ge/core/log.h"
 #include "ge/core/utils.h"
+#include "ge/debug/memory.h"
 #include "ge/debug/profile.h"
 #include "ge/renderer/orthographic_camera.h"
 #include "ge/renderer/shader_program.h"
@@ -46,6 +48,7 @@ namespace GE {
 bool Renderer::initialize(RendererAPI::API api)
 {
     GE_PROFILE_FUNC();
+    GE_MEMORY_TAG(Debug::MemoryTag::RENDERER);
     GE_CORE_DBG("Initialize Renderer");
 
     if (!RenderCommand::initialize(api)) {
@@ -91,6 +94,8 @@ void Renderer::submit(const Shared<ShaderProgram>& shader,
     shader->setUniformMat4(Uniforms::TRANSFORM, transform);
 
     vertex_array->bind();
+
+    GE_PROFILE_GPU_SCOPE("Renderer Submit");
     RenderCommand::draw(vertex_array);
 }
 
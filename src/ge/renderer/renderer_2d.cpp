@@ -32,8 +32,11 @@
 
 #include "renderer_2d.h"
 #include "buffers.h"
+#include "gpu_profiler.h"
 #include "orthographic_camera.h"
 #include "render_command.h"
+#include "render_snapshot.h"
+#include "render_thread.h"
 #include "renderer.h"
 #include "shader_program.h"
 #include "texture.h"
@@ -42,12 +45,14 @@
 #include "ge/core/asserts.h"
 #include "ge/core/log.h"
 #include "ge/core/utils.h"
+#include "ge/debug/memory.h"
 #include "ge/debug/profile.h"
 #include "ge/ecs/components.h"
 #include "ge/ecs/entity.h"
 
 #include <glm/gtc/matrix_transform.hpp>
 
+#include <algorithm>
 #include <array>
 #include <filesystem>
 #include <numeric>
@@ -75,36 +80,35 @@ std::pair<std::string, std::string> getShadersPath(const std::string& assets_dir
     return {shader_path + GE_VERT_EXT, shader_path + GE_FRAG_EXT};
 }
 
-glm::mat4 getTransformMat(const GE::Renderer2D::quad_t& quad)
+} // namespace
+
+namespace GE {
+
+glm::mat4 Renderer2D::quad_t::getTransform() const
 {
-    using Quad = GE::Renderer2D::quad_t;
     glm::mat4 transform{1.0};
 
-    if (quad.pos != Quad::POS_DEFAULT || quad.depth != Quad::DEPTH_DEFAULT) {
-        transform = glm::translate(glm::mat4{1.0f}, {quad.pos, quad.depth});
+    if (pos != POS_DEFAULT || depth != DEPTH_DEFAULT) {
+        transform = glm::translate(glm::mat4{1.0f}, {pos, depth});
     }
 
-    if (quad.rotation != Quad::ROTATION_DEFAULT) {
-        transform =
-            glm::rotate(transform, glm::radians(quad.rotation), {0.0f, 0.0f, 1.0f});
+    if (rotation != ROTATION_DEFAULT) {
+        transform = glm::rotate(transform, glm::radians(rotation), {0.0f, 0.0f, 1.0f});
     }
 
-    if (quad.size != Quad::SIZE_DEFAULT) {
-        transform = glm::scale(transform, {quad.size, 1.0});
+    if (size != SIZE_DEFAULT) {
+        transform = glm::scale(transform, {size, 1.0});
     }
 
     return transform;
 }
 
-} // namespace
-
-namespace GE {
-
 Renderer2D::~Renderer2D() = default;
 
 bool Renderer2D::initialize(const std::string& assets_dir)
 {
     GE_PROFILE_FUNC();
+    GE_MEMORY_TAG(Debug::MemoryTag::RENDERER);
 
     get()->m_assets_dir = assets_dir;
 
@@ -204,13 +208,34 @@ void Renderer2D::draw(const quad_t& quad)
 {
     GE_PROFILE_FUNC();
 
-    get()->draw(draw_object_t{getTransformMat(quad), quad.color, quad.texture,
+    get()->draw(draw_object_t{quad.getTransform(), quad.color, &quad.texture,
                               quad.tiling_factor});
 }
 
+void Renderer2D::draw(const RenderSnapshot& snapshot)
+{
+    GE_PROFILE_FUNC();
+
+    const auto& sprites = snapshot.getSprites();
+
+    for (const auto& view : snapshot.getViews()) {
+        get()->begin(view.vp_matrix);
+
+        for (size_t i{view.sprites_begin}; i < view.sprites_end; i++) {
+            const auto& sprite = sprites[i];
+            get()->draw(draw_object_t{sprite.transform, sprite.color, &sprite.texture,
+                                      sprite.tiling_factor});
+        }
+
+        flush();
+    }
+}
+
 void Renderer2D::flush()
 {
     GE_PROFILE_FUNC();
+    GE_MEMORY_HOT_PATH("Renderer2D::flush");
+    GE_ASSERT_CONTEXT_THREAD();
 
     auto& curr_vert_element = get()->m_curr_vert_element;
     auto& vert_array = get()->m_quad_vert_array;
@@ -227,7 +252,11 @@ void Renderer2D::flush()
     }
 
     get()->m_quad_vao->bind();
-    RenderCommand::draw(get()->m_index_count);
+
+    {
+        GE_PROFILE_GPU_SCOPE("Renderer2D Flush");
+        RenderCommand::draw(get()->m_index_count);
+    }
 
     get()->m_stats.draw_calls_count++;
     get()->resetBatch();
@@ -255,6 +284,7 @@ Renderer2D::Renderer2D()
 void Renderer2D::begin(const glm::mat4& vp_matrix)
 {
     GE_PROFILE_FUNC();
+    GE_ASSERT_CONTEXT_THREAD();
 
     auto tex_shader = m_shader_library.get(TEXTURE_SHADER);
     tex_shader->bind();
@@ -264,6 +294,7 @@ void Renderer2D::begin(const glm::mat4& vp_matrix)
 void Renderer2D::draw(const draw_object_t& draw_object)
 {
     GE_PROFILE_FUNC();
+    GE_MEMORY_HOT_PATH("Renderer2D::draw");
 
     static constexpr glm::mat4 quad_ver_pos = {{-0.5f, -0.5f, 0.0f, 1.0f},
                                                {0.5f, -0.5f, 0.0f, 1.0f},
@@ -304,10 +335,7 @@ void Renderer2D::initializeTextures()
     auto white_texture = Texture2D::create(1, 1, 4);
     white_texture->setData(&white_tex_data, sizeof(white_tex_data));
 
-    for (uint32_t i{0}; i < max_tex_slots; i++) {
-        m_textures.emplace(i, nullptr);
-    }
-
+    m_textures.assign(max_tex_slots, nullptr);
     m_textures[WHITE_TEX_IDX] = std::move(white_texture);
 
     std::vector<int> samplers(max_tex_slots);
@@ -326,11 +354,11 @@ Shared<ShaderProgram> Renderer2D::loadShader(const std::string& name,
     return m_shader_library.load(vert, frag, name);
 }
 
-uint32_t Renderer2D::getTexSlot(const Shared<Texture2D>& texture)
+uint32_t Renderer2D::getTexSlot(const Shared<Texture2D>* texture)
 {
     GE_PROFILE_FUNC();
 
-    if (texture == nullptr) {
+    if (texture == nullptr || *texture == nullptr) {
         return WHITE_TEX_IDX;
     }
 
@@ -338,22 +366,24 @@ uint32_t Renderer2D::getTexSlot(const Shared<Texture2D>& texture)
         flush();
     }
 
-    auto tex_slot_finder = [&texture](const auto& pair) {
-        if (pair.second == nullptr) {
+    auto tex_slot_finder = [texture](const auto& slot) {
+        if (slot == nullptr) {
             return false;
         }
 
-        return *pair.second == *texture;
+        return slot == *texture || *slot == **texture;
     };
 
-    auto it = std::find_if(m_textures.cbegin(), m_textures.cend(), tex_slot_finder);
+    // Slots after the free one keep textures of the previous batch
+    auto slots_end = m_textures.cbegin() + m_curr_free_tex_slot;
+    auto it = std::find_if(m_textures.cbegin(), slots_end, tex_slot_finder);
 
-    if (it != m_textures.cend()) {
-        return it->first;
+    if (it != slots_end) {
+        return std::distance(m_textures.cbegin(), it);
     }
 
     uint32_t curr_slot = m_curr_free_tex_slot;
-    m_textures[curr_slot] = texture;
+    m_textures[curr_slot] = *texture;
     m_curr_free_tex_slot++;
 
     return curr_slot;
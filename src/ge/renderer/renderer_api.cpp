@@ -31,14 +31,18 @@
  */
 
 #include "renderer_api.h"
+#include "headless/renderer_api.h"
+#include "headless/software_renderer_api.h"
 #include "opengl/renderer_api.h"
 
 #include "ge/core/asserts.h"
 #include "ge/core/log.h"
 #include "ge/core/utils.h"
 
-#define API_NONE_STR    "None"
-#define API_OPEN_GL_STR "OpenGL"
+#define API_NONE_STR     "None"
+#define API_OPEN_GL_STR  "OpenGL"
+#define API_HEADLESS_STR "Headless"
+#define API_SOFTWARE_STR "Software"
 
 namespace GE {
 
@@ -48,16 +52,26 @@ Scoped<RendererAPI> RendererAPI::create(API api)
 
     switch (api) {
         case GE_OPEN_GL_API: return makeScoped<OpenGL::RendererAPI>(api);
+        case GE_HEADLESS_API: return makeScoped<Headless::RendererAPI>(api);
+        case GE_SOFTWARE_API: return makeScoped<Headless::SoftwareRendererAPI>(api);
         default: GE_CORE_ASSERT_MSG(false, "Unsupported API: '{}'", api);
     }
 
     return nullptr;
 }
 
+bool RendererAPI::isHeadless(API api)
+{
+    return api == GE_HEADLESS_API || api == GE_SOFTWARE_API;
+}
+
 std::string toString(RendererAPI::API api)
 {
     std::unordered_map<RendererAPI::API, std::string> api_to_str{
-        {GE_NONE_API, API_NONE_STR}, {GE_OPEN_GL_API, API_OPEN_GL_STR}};
+        {GE_NONE_API, API_NONE_STR},
+        {GE_OPEN_GL_API, API_OPEN_GL_STR},
+        {GE_HEADLESS_API, API_HEADLESS_STR},
+        {GE_SOFTWARE_API, API_SOFTWARE_STR}};
 
     return toType(api_to_str, api, {});
 }
@@ -65,7 +79,10 @@ std::string toString(RendererAPI::API api)
 RendererAPI::API toRendAPI(const std::string& api)
 {
     std::unordered_map<std::string, RendererAPI::API> str_to_api{
-        {API_NONE_STR, GE_NONE_API}, {API_OPEN_GL_STR, GE_OPEN_GL_API}};
+        {API_NONE_STR, GE_NONE_API},
+        {API_OPEN_GL_STR, GE_OPEN_GL_API},
+        {API_HEADLESS_STR, GE_HEADLESS_API},
+        {API_SOFTWARE_STR, GE_SOFTWARE_API}};
 
     return toType(str_to_api, api, GE_NONE_API);
 }
@@ -31,6 +31,7 @@
  */
 
 #include "shader.h"
+#include "headless/shader.h"
 #include "opengl/shader.h"
 #include "renderer.h"
 
@@ -43,6 +44,8 @@ Scoped<Shader> Shader::create(Type type)
 {
     switch (Renderer::getAPI()) {
         case GE_OPEN_GL_API: return makeScoped<OpenGL::Shader>(type);
+        case GE_HEADLESS_API:
+        case GE_SOFTWARE_API: return makeScoped<Headless::Shader>(type);
         default: GE_CORE_ASSERT_MSG(false, "Unsupported API: '{}'", Renderer::getAPI());
     }
 
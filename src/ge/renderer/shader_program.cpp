@@ -31,6 +31,7 @@
  */
 
 #include "shader_program.h"
+#include "headless/shader_program.h"
 #include "opengl/shader_program.h"
 
 #include "ge/core/asserts.h"
@@ -65,6 +66,8 @@ Scoped<ShaderProgram> ShaderProgram::create(std::string name)
 
     switch (Renderer::getAPI()) {
         case GE_OPEN_GL_API: return makeScoped<OpenGL::ShaderProgram>(std::move(name));
+        case GE_HEADLESS_API:
+        case GE_SOFTWARE_API: return makeScoped<Headless::ShaderProgram>(std::move(name));
         default: GE_CORE_ASSERT_MSG(false, "Unsupported API: '{}'", Renderer::getAPI());
     }
 
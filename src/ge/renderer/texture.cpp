@@ -31,28 +31,67 @@
  */
 
 #include "texture.h"
+#include "headless/texture.h"
 #include "opengl/texture.h"
+#include "render_thread.h"
 #include "renderer.h"
 
 #include "ge/core/asserts.h"
-#include "ge/core/utils.h"
+#include "ge/core/pool.h"
+#include "ge/debug/memory.h"
+
+#include <new>
+#include <utility>
+
+namespace {
+
+// The last reference may be dropped by the main thread while the render thread
+// owns the context, then the texture is destroyed by the render thread
+template<typename Texture, typename... Args>
+GE::Shared<GE::Texture2D> makeWithContext(Args&&... args)
+{
+    auto* texture = GE::PoolAllocator<Texture>{}.allocate(1);
+    new (texture) Texture(std::forward<Args>(args)...);
+
+    auto release = [](GE::Texture2D* ptr) {
+        GE::RenderThread::runWithContext([ptr] {
+            auto* texture = static_cast<Texture*>(ptr);
+            texture->~Texture();
+            GE::PoolAllocator<Texture>{}.deallocate(texture, 1);
+        });
+    };
+
+    return {texture, release, GE::PoolAllocator<Texture>{}};
+}
+
+} // namespace
 
 namespace GE {
 
-Scoped<Texture2D> Texture2D::create(std::string path)
+Shared<Texture2D> Texture2D::create(std::string path)
 {
+    GE_MEMORY_TAG(Debug::MemoryTag::TEXTURES);
+
     switch (Renderer::getAPI()) {
-        case GE_OPEN_GL_API: return makeScoped<OpenGL::Texture2D>(std::move(path));
+        case GE_OPEN_GL_API: return makeWithContext<OpenGL::Texture2D>(std::move(path));
+        case GE_HEADLESS_API:
+        case GE_SOFTWARE_API: return makePooled<Headless::Texture2D>(std::move(path));
         default: GE_CORE_ASSERT_MSG(false, "Unsupported API: '{}'", Renderer::getAPI());
     }
 
     return nullptr;
 }
 
-Scoped<Texture2D> Texture2D::create(uint32_t width, uint32_t height, uint32_t bpp)
+Shared<Texture2D> Texture2D::create(uint32_t width, uint32_t height, uint32_t bpp)
 {
+    GE_MEMORY_TAG(Debug::MemoryTag::TEXTURES);
+
     switch (Renderer::getAPI()) {
-        case GE_OPEN_GL_API: return makeScoped<OpenGL::Texture2D>(width, height, bpp);
+        case GE_OPEN_GL_API:
+            return makeWithContext<OpenGL::Texture2D>(width, height, bpp);
+        case GE_HEADLESS_API:
+        case GE_SOFTWARE_API:
+            return makePooled<Headless::Texture2D>(width, height, bpp);
         default: GE_CORE_ASSERT_MSG(false, "Unsupported API: '{}'", Renderer::getAPI());
     }
 
@@ -44,6 +44,9 @@
 #define OPENGL_MAJOR_VERSION 4
 #define OPENGL_MINOR_VERSION 5
 
+// An error reported every draw call must not slow down the frame
+#define GL_DBG_MESSAGES_PER_SEC 10
+
 namespace {
 
 #if defined(GE_DEBUG)
@@ -54,11 +57,26 @@ void openglDbgCallback([[maybe_unused]] GLenum source, [[maybe_unused]] GLenum t
                        [[maybe_unused]] const void* userParam)
 {
     switch (severity) {
-        case GL_DEBUG_SEVERITY_HIGH: GE_CORE_CRIT(message); return;        // NOLINT
-        case GL_DEBUG_SEVERITY_MEDIUM: GE_CORE_ERR(message); return;       // NOLINT
-        case GL_DEBUG_SEVERITY_LOW: GE_CORE_WARN(message); return;         // NOLINT
-        case GL_DEBUG_SEVERITY_NOTIFICATION: GE_CORE_DBG(message); return; // NOLINT
-        case GL_DONT_CARE: GE_CORE_TRACE(message); return;
+        case GL_DEBUG_SEVERITY_HIGH:
+            GE_LOG_PER_SEC(GL_DBG_MESSAGES_PER_SEC, GE_CORE_CRIT_CAT, RENDERER, "{}",
+                           message);
+            return;
+        case GL_DEBUG_SEVERITY_MEDIUM:
+            GE_LOG_PER_SEC(GL_DBG_MESSAGES_PER_SEC, GE_CORE_ERR_CAT, RENDERER, "{}",
+                           message);
+            return;
+        case GL_DEBUG_SEVERITY_LOW:
+            GE_LOG_PER_SEC(GL_DBG_MESSAGES_PER_SEC, GE_CORE_WARN_CAT, RENDERER, "{}",
+                           message);
+            return;
+        case GL_DEBUG_SEVERITY_NOTIFICATION:
+            GE_LOG_PER_SEC(GL_DBG_MESSAGES_PER_SEC, GE_CORE_DBG_CAT, RENDERER, "{}",
+                           message);
+            return;
+        case GL_DONT_CARE:
+            GE_LOG_PER_SEC(GL_DBG_MESSAGES_PER_SEC, GE_CORE_TRACE_CAT, RENDERER, "{}",
+                           message);
+            return;
         default: GE_CORE_ASSERT_MSG(false, "Unknown severity level: {}", severity);
     }
 }
@@ -141,6 +159,20 @@ void OpenGLContext::swapBuffers()
     SDL_GL_SwapWindow(m_window);
 }
 
+void OpenGLContext::makeCurrent()
+{
+    GE_PROFILE_FUNC();
+
+    SDLCall(SDL_GL_MakeCurrent(m_window, m_gl_context));
+}
+
+void OpenGLContext::releaseCurrent()
+{
+    GE_PROFILE_FUNC();
+
+    SDLCall(SDL_GL_MakeCurrent(m_window, nullptr));
+}
+
 void OpenGLContext::deleteContext()
 {
     GE_PROFILE_FUNC();
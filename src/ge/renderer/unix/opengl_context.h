@@ -50,6 +50,8 @@ public:
     void shutdown() override;
 
     void swapBuffers() override;
+    void makeCurrent() override;
+    void releaseCurrent() override;
     void* getNativeContext() const override { return m_gl_context; }
 
 private:
@@ -30,18 +30,21 @@
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include "headless/vertex_array.h"
 #include "opengl/vertex_array.h"
 #include "renderer.h"
 
 #include "ge/core/asserts.h"
-#include "ge/core/utils.h"
+#include "ge/core/pool.h"
 
 namespace GE {
 
-Scoped<VertexArray> VertexArray::create()
+Shared<VertexArray> VertexArray::create()
 {
     switch (Renderer::getAPI()) {
-        case GE_OPEN_GL_API: return makeScoped<OpenGL::VertexArray>();
+        case GE_OPEN_GL_API: return makePooled<OpenGL::VertexArray>();
+        case GE_HEADLESS_API:
+        case GE_SOFTWARE_API: return makePooled<Headless::VertexArray>();
         default: GE_CORE_ASSERT_MSG(false, "Unsupported API: '{}'", Renderer::getAPI());
     }
 
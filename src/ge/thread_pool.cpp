@@ -34,6 +34,7 @@
 
 #include "ge/core/asserts.h"
 #include "ge/core/log.h"
+#include "ge/debug/counters.h"
 
 namespace GE {
 
@@ -72,6 +73,7 @@ void ThreadPool::stop()
 {
     m_terminated = true;
     m_condition.notify_all();
+    m_idle_condition.notify_all();
 
     for (auto& worker : m_workers) {
         if (worker.joinable()) {
@@ -82,6 +84,14 @@ void ThreadPool::stop()
     GE_CORE_DBG("Thread pool '{}' has been stopped", m_name);
 }
 
+void ThreadPool::wait()
+{
+    std::unique_lock lock{m_queue_mtx};
+    m_idle_condition.wait(lock, [this] {
+        return m_terminated || (m_queue.empty() && m_active_tasks == 0);
+    });
+}
+
 void ThreadPool::workerThread()
 {
     auto wake_up_cond = [this] { return m_terminated || !m_queue.empty(); };
@@ -98,11 +108,22 @@ void ThreadPool::workerThread()
             break;
         }
 
-        auto task = m_queue.front();
+        auto task = std::move(m_queue.front());
         m_queue.pop();
+        m_active_tasks++;
         lock.unlock();
 
         task();
+        GE_COUNTER("Jobs executed", 1);
+
+        lock.lock();
+        m_active_tasks--;
+        bool is_idle = m_queue.empty() && m_active_tasks == 0;
+        lock.unlock();
+
+        if (is_idle) {
+            m_idle_condition.notify_all();
+        }
     }
 }
 
@@ -0,0 +1,118 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "event_queue.h"
+
+#include "ge/core/log.h"
+#include "ge/debug/profile.h"
+
+namespace {
+
+template<typename EventType>
+bool coalesce([[maybe_unused]] EventType* last, [[maybe_unused]] const EventType& event)
+{
+    return false;
+}
+
+bool coalesce(GE::MouseMovedEvent* last, const GE::MouseMovedEvent& event)
+{
+    *last = event;
+    return true;
+}
+
+bool coalesce(GE::MouseScrolledEvent* last, const GE::MouseScrolledEvent& event)
+{
+    *last = GE::MouseScrolledEvent{last->getOffsetX() + event.getOffsetX(),
+                                   last->getOffsetY() + event.getOffsetY()};
+    return true;
+}
+
+bool coalesce(GE::WindowResizedEvent* last, const GE::WindowResizedEvent& event)
+{
+    *last = event;
+    return true;
+}
+
+} // namespace
+
+namespace GE {
+
+EventQueue::EventQueue(size_t capacity)
+{
+    m_events.reserve(capacity);
+    m_dispatched.reserve(capacity);
+}
+
+void EventQueue::push(const Event& event)
+{
+    GE_PROFILE_FUNC();
+
+    switch (event.getType()) {
+        case Event::Type::KEY_PRESSED: pushEvent<KeyPressedEvent>(event); break;
+        case Event::Type::KEY_RELEASED: pushEvent<KeyReleasedEvent>(event); break;
+        case Event::Type::KEY_TYPED: pushEvent<KeyTypedEvent>(event); break;
+        case Event::Type::MOUSE_MOVED: pushEvent<MouseMovedEvent>(event); break;
+        case Event::Type::MOUSE_SCROLLED: pushEvent<MouseScrolledEvent>(event); break;
+        case Event::Type::MOUSE_BUTTON_PRESSED:
+            pushEvent<MouseButtonPressedEvent>(event);
+            break;
+        case Event::Type::MOUSE_BUTTON_RELEASED:
+            pushEvent<MouseButtonReleasedEvent>(event);
+            break;
+        case Event::Type::WINDOW_RESIZED: pushEvent<WindowResizedEvent>(event); break;
+        case Event::Type::WINDOW_CLOSED: pushEvent<WindowClosedEvent>(event); break;
+        case Event::Type::WINDOW_MAXIMIZED: pushEvent<WindowMaximizedEvent>(event); break;
+        case Event::Type::WINDOW_MINIMIZED: pushEvent<WindowMinimizedEvent>(event); break;
+        case Event::Type::WINDOW_RESTORED: pushEvent<WindowRestoredEvent>(event); break;
+        case Event::Type::USER: pushEvent<UserEvent>(event); break;
+        default: GE_CORE_ERR("Unknown event type: '{}'", event.getName()); break;
+    }
+}
+
+template<typename EventType>
+void EventQueue::pushEvent(const Event& event)
+{
+    const auto& typed_event = static_cast<const EventType&>(event);
+
+    if (!m_events.empty()) {
+        auto* last = std::get_if<EventType>(&m_events.back());
+
+        if (last != nullptr && coalesce(last, typed_event)) {
+            m_coalesced++;
+            return;
+        }
+    }
+
+    m_events.emplace_back(typed_event);
+}
+
+} // namespace GE
@@ -0,0 +1,80 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "window.h"
+
+#include "ge/core/asserts.h"
+#include "ge/core/log.h"
+#include "ge/debug/profile.h"
+
+namespace GE::Headless {
+
+Window::Window(properties_t prop)
+    : m_prop(std::move(prop))
+{
+    GE_PROFILE_FUNC();
+    GE_CORE_DBG("Create headless window '{}', ({}, {})", m_prop.title, m_prop.width,
+                m_prop.height);
+
+    m_context = GraphicsContext::create(nullptr);
+    GE_CORE_ASSERT_MSG(m_context != nullptr, "Failed to create graphics context");
+    m_context->initialize();
+}
+
+Window::~Window()
+{
+    GE_PROFILE_FUNC();
+
+    if (m_context != nullptr) {
+        m_context->shutdown();
+    }
+}
+
+bool Window::initialize()
+{
+    GE_CORE_DBG("Initialize Headless::Window");
+    return true;
+}
+
+void Window::shutdown()
+{
+    GE_CORE_DBG("Shutdown Headless::Window");
+}
+
+void Window::onUpdate()
+{
+    GE_PROFILE_FUNC();
+
+    m_context->swapBuffers();
+}
+
+} // namespace GE::Headless
@@ -31,10 +31,14 @@
  */
 
 #include "input.h"
+#include "headless/input.h"
 
 #include "ge/core/log.h"
 #include "ge/core/utils.h"
 #include "ge/debug/profile.h"
+#include "ge/renderer/renderer.h"
+#include "ge/window/key_event.h"
+#include "ge/window/mouse_event.h"
 
 #if defined(GE_PLATFORM_UNIX)
     #include "unix/input.h"
@@ -43,6 +47,19 @@ using PlatformInput = ::GE::UNIX::InputImpl;
     #error "Platform is not defined!"
 #endif
 
+namespace {
+
+GE::Scoped<GE::InputImpl> createInputImpl()
+{
+    if (GE::RendererAPI::isHeadless(GE::Renderer::getAPI())) {
+        return GE::makeScoped<GE::Headless::InputImpl>();
+    }
+
+    return GE::makeScoped<PlatformInput>();
+}
+
+} // namespace
+
 namespace GE {
 
 bool Input::initialize()
@@ -51,11 +68,12 @@ bool Input::initialize()
 
     auto& pimpl = get()->m_pimpl;
 
-    if (pimpl = makeScoped<PlatformInput>(); pimpl == nullptr) {
+    if (pimpl = createInputImpl(); pimpl == nullptr) {
         GE_CORE_ERR("Failed to create Platform::InputImpl");
         return false;
     }
 
+    get()->m_snapshot.reset();
     return pimpl->initialize();
 }
 
@@ -67,4 +85,46 @@ void Input::shutdown()
     get()->m_pimpl.reset();
 }
 
+void Input::update()
+{
+    GE_PROFILE_FUNC();
+
+    auto& snapshot = get()->m_snapshot;
+    snapshot.nextFrame();
+    get()->m_pimpl->updateSnapshot(&snapshot);
+}
+
+void Input::beginReplayFrame()
+{
+    get()->m_snapshot.nextFrame();
+}
+
+void Input::replayEvent(const Event& event)
+{
+    auto& snapshot = get()->m_snapshot;
+
+    switch (event.getType()) {
+        case Event::Type::KEY_PRESSED:
+        case Event::Type::KEY_RELEASED: {
+            const auto& key_event = static_cast<const KeyEvent&>(event);
+            bool is_pressed = event.getType() == Event::Type::KEY_PRESSED;
+            snapshot.setKeyPressed(key_event.getKeyCode(), is_pressed);
+            break;
+        }
+        case Event::Type::MOUSE_MOVED: {
+            const auto& mouse_moved = static_cast<const MouseMovedEvent&>(event);
+            snapshot.setMousePos({mouse_moved.getPosX(), mouse_moved.getPosY()});
+            break;
+        }
+        case Event::Type::MOUSE_BUTTON_PRESSED:
+        case Event::Type::MOUSE_BUTTON_RELEASED: {
+            const auto& button_event = static_cast<const MouseButtonEvent&>(event);
+            bool is_pressed = event.getType() == Event::Type::MOUSE_BUTTON_PRESSED;
+            snapshot.setMouseButtonPressed(button_event.getMouseButton(), is_pressed);
+            break;
+        }
+        default: break;
+    }
+}
+
 } // namespace GE
@@ -0,0 +1,356 @@
+/*
+ * BSD 3-Clause License
+ *
+ * Copyright (c) 2020, Dmitry Shilnenkov
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "input_recording.h"
+
+#include "ge/core/log.h"
+#include "ge/debug/profile.h"
+#include "ge/window/key_event.h"
+#include "ge/window/mouse_event.h"
+#include "ge/window/window_event.h"
+
+#include <cstring>
+
+namespace {
+
+constexpr char MAGIC[] = {'G', 'E', 'I', 'R'};
+constexpr uint16_t VERSION{1};
+
+// Events are tagged by their type, frames use a tag out of the type range
+constexpr uint8_t FRAME_TAG{0xFF};
+
+template<typename EventType>
+const EventType& as(const GE::Event& event)
+{
+    return static_cast<const EventType&>(event);
+}
+
+uint8_t toTag(GE::Event::Type type)
+{
+    return static_cast<uint8_t>(type);
+}
+
+} // namespace
+
+namespace GE {
+
+bool InputRecorder::open(const std::string& filename)
+{
+    GE_PROFILE_FUNC();
+
+    m_file.open(filename, std::ios::binary | std::ios::trunc);
+
+    if (!m_file.is_open()) {
+        GE_CORE_ERR("Failed to open input recording file '{}'", filename);
+        return false;
+    }
+
+    m_file.write(MAGIC, sizeof(MAGIC));
+    write(VERSION);
+    m_filename = filename;
+
+    GE_CORE_INFO("Recording input to '{}'", filename);
+    return true;
+}
+
+void InputRecorder::close()
+{
+    GE_PROFILE_FUNC();
+
+    if (m_file.is_open()) {
+        m_file.close();
+        GE_CORE_INFO("Input recording '{}' has been closed", m_filename);
+    }
+
+    m_filename.clear();
+}
+
+void InputRecorder::beginFrame(Timestamp delta_time)
+{
+    write(FRAME_TAG);
+    write(delta_time.sec());
+}
+
+void InputRecorder::record(const Event& event)
+{
+    GE_PROFILE_FUNC();
+
+    auto type = event.getType();
+
+    switch (type) {
+        case Event::Type::KEY_PRESSED: {
+            const auto& key_pressed = as<KeyPressedEvent>(event);
+            write(toTag(type));
+            write(key_pressed.getKeyCode());
+            write(key_pressed.getRepeatCount());
+            break;
+        }
+        case Event::Type::KEY_RELEASED:
+            write(toTag(type));
+            write(as<KeyReleasedEvent>(event).getKeyCode());
+            break;
+        case Event::Type::KEY_TYPED: {
+            const char* text = as<KeyTypedEvent>(event).getText();
+            auto length = static_cast<uint8_t>(std::strlen(text));
+            write(toTag(type));
+            write(length);
+            m_file.write(text, length);
+            break;
+        }
+        case Event::Type::MOUSE_MOVED: {
+            const auto& mouse_moved = as<MouseMovedEvent>(event);
+            write(toTag(type));
+            write(mouse_moved.getPosX());
+            write(mouse_moved.getPosY());
+            break;
+        }
+        case Event::Type::MOUSE_SCROLLED: {
+            const auto& mouse_scrolled = as<MouseScrolledEvent>(event);
+            write(toTag(type));
+            write(mouse_scrolled.getOffsetX());
+            write(mouse_scrolled.getOffsetY());
+            break;
+        }
+        case Event::Type::MOUSE_BUTTON_PRESSED:
+        case Event::Type::MOUSE_BUTTON_RELEASED:
+            write(toTag(type));
+            write(static_cast<const MouseButtonEvent&>(event).getMouseButton());
+            break;
+        case Event::Type::WINDOW_RESIZED: {
+            const auto& window_resized = as<WindowResizedEvent>(event);
+            write(toTag(type));
+            write(window_resized.getWidth());
+            write(window_resized.getHeight());
+            break;
+        }
+        case Event::Type::WINDOW_CLOSED:
+        case Event::Type::WINDOW_MAXIMIZED:
+        case Event::Type::WINDOW_MINIMIZED:
+        case Event::Type::WINDOW_RESTORED: write(toTag(type)); break;
+        default: break;
+    }
+}
+
+template<typename T>
+void InputRecorder::write(const T& value)
+{
+    m_file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+bool InputReplay::open(const std::string& filename)
+{
+    GE_PROFILE_FUNC();
+
+    std::ifstream file{filename, std::ios::binary};
+
+    if (!file.is_open()) {
+        GE_CORE_ERR("Failed to open input recording file '{}'", filename);
+        return false;
+    }
+
+    // The whole stream is loaded, so the replay doesn't wait for the disk
+    std::vector<char> data{std::istreambuf_iterator<char>{file},
+                           std::istreambuf_iterator<char>{}};
+    uint16_t version{0};
+    m_data = std::move(data);
+    m_pos = sizeof(MAGIC);
+
+    if (m_data.size() < sizeof(MAGIC) ||
+        std::memcmp(m_data.data(), MAGIC, sizeof(MAGIC)) != 0 || !read(&version) ||
+        version != VERSION) {
+        GE_CORE_ERR("'{}' is not an input recording of version {}", filename, VERSION);
+        close();
+        return false;
+    }
+
+    m_filename = filename;
+    GE_CORE_INFO("Replaying input from '{}'", filename);
+    return true;
+}
+
+void InputReplay::close()
+{
+    m_data.clear();
+    m_data.shrink_to_fit();
+    m_pos = 0;
+    m_filename.clear();
+}
+
+bool InputReplay::nextFrame(Timestamp* delta_time)
+{
+    GE_PROFILE_FUNC();
+
+    uint8_t tag{0};
+    double delta_sec{0.0};
+
+    // Events without a frame are skipped, e.g. the tail of an incomplete stream
+    while (read(&tag)) {
+        if (tag == FRAME_TAG) {
+            if (!read(&delta_sec)) {
+                return false;
+            }
+
+            *delta_time = delta_sec;
+            return true;
+        }
+
+        if (!readEvent(tag, [](const Event& /*event*/) {})) {
+            return false;
+        }
+    }
+
+    return false;
+}
+
+void InputReplay::readEvents(const EventCallback& callback)
+{
+    GE_PROFILE_FUNC();
+
+    uint8_t tag{0};
+
+    while (m_pos < m_data.size() && static_cast<uint8_t>(m_data[m_pos]) != FRAME_TAG) {
+        if (!read(&tag) || !readEvent(tag, callback)) {
+            GE_CORE_ERR("Input recording '{}' is corrupted", m_filename);
+            m_pos = m_data.size();
+            return;
+        }
+    }
+}
+
+template<typename T>
+bool InputReplay::read(T* value)
+{
+    if (m_pos + sizeof(T) > m_data.size()) {
+        return false;
+    }
+
+    std::memcpy(value, m_data.data() + m_pos, sizeof(T));
+    m_pos += sizeof(T);
+    return true;
+}
+
+bool InputReplay::readEvent(uint8_t tag, const EventCallback& callback)
+{
+    switch (static_cast<Event::Type>(tag)) {
+        case Event::Type::KEY_PRESSED: {
+            KeyCode key_code{};
+            uint32_t repeat_count{};
+
+            if (!read(&key_code) || !read(&repeat_count)) {
+                return false;
+            }
+
+            callback(KeyPressedEvent{key_code, repeat_count});
+            return true;
+        }
+        case Event::Type::KEY_RELEASED: {
+            KeyCode key_code{};
+
+            if (!read(&key_code)) {
+                return false;
+            }
+
+            callback(KeyReleasedEvent{key_code});
+            return true;
+        }
+        case Event::Type::KEY_TYPED: {
+            uint8_t length{0};
+            char text[KeyTypedEvent::TEXT_SIZE]{};
+
+            if (!read(&length) || m_pos + length > m_data.size() ||
+                length >= KeyTypedEvent::TEXT_SIZE) {
+                return false;
+            }
+
+            std::memcpy(text, m_data.data() + m_pos, length);
+            m_pos += length;
+            callback(KeyTypedEvent{text});
+            return true;
+        }
+        case Event::Type::MOUSE_MOVED: {
+            float x{};
+            float y{};
+
+            if (!read(&x) || !read(&y)) {
+                return false;
+            }
+
+            callback(MouseMovedEvent{x, y});
+            return true;
+        }
+        case Event::Type::MOUSE_SCROLLED: {
+            float offset_x{};
+            float offset_y{};
+
+            if (!read(&offset_x) || !read(&offset_y)) {
+                return false;
+            }
+
+            callback(MouseScrolledEvent{offset_x, offset_y});
+            return true;
+        }
+        case Event::Type::MOUSE_BUTTON_PRESSED:
+        case Event::Type::MOUSE_BUTTON_RELEASED: {
+            MouseButton button{};
+
+            if (!read(&button)) {
+                return false;
+            }
+
+            if (tag == toTag(Event::Type::MOUSE_BUTTON_PRESSED)) {
+                callback(MouseButtonPressedEvent{button});
+            } else {
+                callback(MouseButtonReleasedEvent{button});
+            }
+
+            return true;
+        }
+        case Event::Type::WINDOW_RESIZED: {
+            uint32_t width{};
+            uint32_t height{};
+
+            if (!read(&width) || !read(&height)) {
+                return false;
+            }
+
+            callback(WindowResizedEvent{width, height});
+            return true;
+        }
+        case Event::Type::WINDOW_CLOSED: callback(WindowClosedEvent{}); return true;
+        case Event::Type::WINDOW_MAXIMIZED: callback(WindowMaximizedEvent{}); return true;
+        case Event::Type::WINDOW_MINIMIZED: callback(WindowMinimizedEvent{}); return true;
+        case Event::Type::WINDOW_RESTORED: callback(WindowRestoredEvent{}); return true;
+        default: return false;
+    }
+}
+
+} // namespace GE
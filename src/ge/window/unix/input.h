@@ -38,7 +38,7 @@
 #include "ge/window/key_codes.h"
 #include "ge/window/mouse_button_codes.h"
 
-#include <unordered_map>
+#include <array>
 
 namespace GE::UNIX {
 
@@ -50,22 +50,16 @@ public:
 
     int32_t toNativeKeyCode(KeyCode key_code) const override;
     KeyCode toGEKeyCode(int32_t key_code) const override;
-    bool isKeyPressed(KeyCode key_code) const override;
 
     uint8_t toNativeButton(MouseButton button) const override;
     MouseButton toGEMouseButton(uint8_t button) const override;
-    bool isMouseButtonPressed(MouseButton button) const override;
-    glm::vec2 getMousePos() const override;
 
-private:
-    void mapKeyCodes();
-    void mapMouseButtons();
+    void updateSnapshot(InputSnapshot* snapshot) const override;
 
-    std::unordered_map<int32_t, KeyCode> m_sdl_to_ge_keys;
-    std::unordered_map<KeyCode, int32_t> m_ge_to_sdl_keys;
+private:
+    void mapScancodes();
 
-    std::unordered_map<uint8_t, MouseButton> m_sdl_to_ge_buttons;
-    std::unordered_map<MouseButton, uint8_t> m_ge_to_sdl_buttons;
+    std::array<int32_t, KEY_CODES_COUNT> m_scancodes{};
 };
 
 } // namespace GE::UNIX
@@ -133,7 +133,7 @@ void Window::onUpdate()
     GE_PROFILE_FUNC();
 
     pollEvents();
-    m_context->swapBuffers();
+    swapBuffers();
 }
 
 void Window::pollEvents()
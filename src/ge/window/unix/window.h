@@ -61,13 +61,16 @@ public:
     const properties_t& getProps() const override { return m_prop; }
 
     void onUpdate() override;
+    void pollEvents() override;
+    void swapBuffers() override { m_context->swapBuffers(); }
+    void makeContextCurrent() override { m_context->makeCurrent(); }
+    void releaseContext() override { m_context->releaseCurrent(); }
     void setEventCallback(WinEventCallback callback) override
     {
         m_event_callback = callback;
     }
 
 private:
-    void pollEvents();
     void onSDLMouseEvent(const SDL_Event& sdl_event);
     void onSDLKeyEvent(const SDL_Event& sdl_event);
     void onSDLWindowEvent(const SDL_Event& sdl_event);
@@ -31,11 +31,13 @@
  */
 
 #include "window.h"
+#include "headless/window.h"
 #include "input.h"
 
 #include "ge/core/log.h"
 #include "ge/core/utils.h"
 #include "ge/debug/profile.h"
+#include "ge/renderer/renderer.h"
 
 #if defined(GE_PLATFORM_UNIX)
     #include "unix/window.h"
@@ -49,6 +51,10 @@ namespace GE {
 
 Scoped<Window> Window::create(properties_t prop)
 {
+    if (RendererAPI::isHeadless(Renderer::getAPI())) {
+        return makeScoped<Headless::Window>(std::move(prop));
+    }
+
     return makeScoped<PlatformWindow>(std::move(prop));
 }
 
@@ -56,7 +62,11 @@ bool Window::initialize()
 {
     GE_PROFILE_FUNC();
 
-    if (!Input::initialize() || !PlatformWindow::initialize()) {
+    bool is_headless = RendererAPI::isHeadless(Renderer::getAPI());
+    bool is_window_initialized =
+        is_headless ? Headless::Window::initialize() : PlatformWindow::initialize();
+
+    if (!Input::initialize() || !is_window_initialized) {
         GE_CORE_ERR("Failed to initialize Window system");
         return false;
     }
@@ -68,7 +78,12 @@ void Window::shutdown()
 {
     GE_PROFILE_FUNC();
 
-    PlatformWindow::shutdown();
+    if (RendererAPI::isHeadless(Renderer::getAPI())) {
+        Headless::Window::shutdown();
+    } else {
+        PlatformWindow::shutdown();
+    }
+
     Input::shutdown();
 }
 
@@ -1,16 +1,34 @@
+#include "ge/application.h"
 #include "ge/core/asserts.h"
+#include "ge/core/bounded_queue.h"
 #include "ge/core/core.h"
+#include "ge/core/fixed_timestep.h"
+#include "ge/core/frame_arena.h"
+#include "ge/core/frame_pacer.h"
 #include "ge/core/log.h"
+#include "ge/core/pool.h"
 #include "ge/core/timestamp.h"
 #include "ge/core/utils.h"
+#include "ge/debug/counters.h"
+#include "ge/debug/memory.h"
 #include "ge/debug/profile.h"
+#include "ge/debug/trace_converter.h"
 #include "ge/layer.h"
 #include "ge/layer_stack.h"
+#include "ge/renderer/renderer.h"
 #include "ge/window/key_event.h"
+#include "ge/window/window.h"
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string_view>
+#include <thread>
+
 namespace {
 
 class GECoreTest: public ::testing::Test
@@ -40,6 +58,256 @@ TEST_F(GECoreTest, ClientLogger)
     GE_CRIT("crit =(");
 }
 
+uint32_t countLines(const std::filesystem::path& path, std::string_view text)
+{
+    std::ifstream file{path};
+    std::string line;
+    uint32_t count{0};
+
+    while (std::getline(file, line)) {
+        count += line.find(text) != std::string::npos ? 1 : 0;
+    }
+
+    return count;
+}
+
+TEST(LogTest, AsyncBlock)
+{
+    constexpr uint32_t messages_count{100};
+    std::filesystem::path log_file =
+        std::filesystem::temp_directory_path() / "ge_async_block.log";
+    std::filesystem::remove(log_file);
+
+    GE::Log::properties_t props{};
+    props.async = true;
+    props.queue_size = 8;
+    props.file = log_file.string();
+    ASSERT_TRUE(GE::Log::initialize(props));
+
+    std::string long_message(1000, 'x');
+    GE_CORE_INFO("{}", long_message);
+
+    for (uint32_t i{0}; i < messages_count; i++) {
+        GE_CORE_INFO("Async message: {}", i);
+    }
+
+    GE::Log::flush();
+    EXPECT_EQ(countLines(log_file, "Async message"), messages_count);
+    EXPECT_EQ(countLines(log_file, long_message), 1u);
+    EXPECT_EQ(GE::Log::getDroppedMessages(), 0u);
+
+    GE::Log::shutdown();
+    std::filesystem::remove(log_file);
+}
+
+TEST(LogTest, AsyncDrop)
+{
+    constexpr uint32_t messages_count{1000};
+    std::filesystem::path log_file =
+        std::filesystem::temp_directory_path() / "ge_async_drop.log";
+    std::filesystem::remove(log_file);
+
+    GE::Log::properties_t props{};
+    props.async = true;
+    props.queue_size = 8;
+    props.overflow_policy = GE::Log::OverflowPolicy::DROP;
+    props.file = log_file.string();
+    ASSERT_TRUE(GE::Log::initialize(props));
+    GE::Log::core()->setLevel(GE_LOGLVL_WARN);
+
+    for (uint32_t i{0}; i < messages_count; i++) {
+        GE_CORE_WARN("Async message: {}", i);
+    }
+
+    GE::Log::flush();
+    uint64_t dropped = GE::Log::getDroppedMessages();
+    EXPECT_EQ(countLines(log_file, "Async message") + dropped, messages_count);
+
+    GE::Log::shutdown();
+    std::filesystem::remove(log_file);
+}
+
+TEST(LogTest, Deferred)
+{
+    constexpr uint32_t threads_count{4};
+    constexpr uint32_t messages_count{500};
+    std::filesystem::path log_file =
+        std::filesystem::temp_directory_path() / "ge_deferred.log";
+    std::filesystem::remove(log_file);
+
+    GE::Log::properties_t props{};
+    props.deferred = true;
+    props.queue_size = 64;
+    props.file = log_file.string();
+    ASSERT_TRUE(GE::Log::initialize(props));
+
+    std::vector<std::thread> threads;
+
+    for (uint32_t i{0}; i < threads_count; i++) {
+        threads.emplace_back([i] {
+            for (uint32_t j{0}; j < messages_count; j++) {
+                GE_CORE_INFO("Deferred message: {} {:.1f} {}", i, 0.5, "text");
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    std::string name{"name"};
+    GE_CORE_INFO("Deferred string: {}", name);
+    GE_CORE_INFO("Deferred literal {}");
+
+    // The record keeps a copy of the format
+    char format[] = "Deferred array: {}";
+    GE_CORE_INFO(format, 1);
+    format[0] = 'X';
+
+    GE_CORE_INFO("Immediate message: {}", static_cast<const void*>(nullptr));
+    GE_CORE_DBG("Filtered message: {}", 1);
+    GE::Log::core()->setLevel(GE_LOGLVL_INFO);
+    GE_CORE_DBG("Filtered message: {}", 2);
+
+    GE::Log::flush();
+    EXPECT_EQ(countLines(log_file, "Deferred message: "), threads_count * messages_count);
+    EXPECT_EQ(countLines(log_file, "Deferred message: 3 0.5 text"), messages_count);
+    EXPECT_EQ(countLines(log_file, "Deferred string: name"), 1u);
+    EXPECT_EQ(countLines(log_file, "Deferred literal {}"), 1u);
+    EXPECT_EQ(countLines(log_file, "Deferred array: 1"), 1u);
+    EXPECT_EQ(countLines(log_file, "Immediate message: 0x0"), 1u);
+    EXPECT_EQ(countLines(log_file, "Filtered message: 1"), 1u);
+    EXPECT_EQ(countLines(log_file, "Filtered message: 2"), 0u);
+
+    GE::Log::shutdown();
+    std::filesystem::remove(log_file);
+}
+
+TEST(LogTest, Categories)
+{
+    std::filesystem::path log_file =
+        std::filesystem::temp_directory_path() / "ge_categories.log";
+    std::filesystem::remove(log_file);
+
+    GE::Log::properties_t props{};
+    props.file = log_file.string();
+    ASSERT_TRUE(GE::Log::initialize(props));
+
+    auto* logger = GE::Log::core();
+    logger->setCategoryLevel(GE::LogCategory::RENDERER, GE_LOGLVL_WARN);
+    logger->setCategoryLevel(GE::LogCategory::ECS, GE_LOGLVL_NONE);
+
+    EXPECT_EQ(logger->getCategoryLevel(GE::LogCategory::RENDERER), GE_LOGLVL_WARN);
+    EXPECT_EQ(logger->getCategoryLevel(GE::LogCategory::GUI), GE_LOGLVL_TRACE);
+    EXPECT_TRUE(logger->isEnabled(GE::LogCategory::RENDERER, GE_LOGLVL_ERR));
+    EXPECT_FALSE(logger->isEnabled(GE::LogCategory::RENDERER, GE_LOGLVL_INFO));
+    EXPECT_FALSE(logger->isEnabled(GE::LogCategory::ECS, GE_LOGLVL_CRIT));
+
+    GE_CORE_INFO_CAT(RENDERER, "Renderer info");
+    GE_CORE_WARN_CAT(RENDERER, "Renderer warning");
+    GE_CORE_CRIT_CAT(ECS, "ECS critical");
+    GE_CORE_TRACE_CAT(GUI, "GUI trace");
+    logger->setCategoryLevel(GE::LogCategory::GENERAL, GE_LOGLVL_ERR);
+    GE_CORE_WARN("General warning");
+    GE_CORE_ERR("General error");
+    logger->setCategoryLevel(GE::LogCategory::GENERAL, GE_LOGLVL_TRACE);
+
+    GE::Log::flush();
+    EXPECT_EQ(countLines(log_file, "Renderer info"), 0u);
+    EXPECT_EQ(countLines(log_file, "Renderer warning"), 1u);
+    EXPECT_EQ(countLines(log_file, "ECS critical"), 0u);
+    EXPECT_EQ(countLines(log_file, "GUI trace"), 1u);
+    EXPECT_EQ(countLines(log_file, "General warning"), 0u);
+    EXPECT_EQ(countLines(log_file, "General error"), 1u);
+
+    GE::Log::shutdown();
+    std::filesystem::remove(log_file);
+}
+
+TEST(LogTest, RateLimit)
+{
+    std::filesystem::path log_file =
+        std::filesystem::temp_directory_path() / "ge_rate_limit.log";
+    std::filesystem::remove(log_file);
+
+    GE::Log::properties_t props{};
+    props.file = log_file.string();
+    ASSERT_TRUE(GE::Log::initialize(props));
+
+    for (uint32_t i{0}; i < 100; i++) {
+        GE_CORE_WARN_EVERY_N(10, "Every n: {}", i);
+        GE_CORE_WARN_PER_SEC(5, "Per second: {}", i);
+    }
+
+    GE::Log::flush();
+    EXPECT_EQ(countLines(log_file, "Every n: "), 10u);
+    EXPECT_EQ(countLines(log_file, "Every n: 90"), 1u);
+    EXPECT_EQ(countLines(log_file, "Per second: "), 5u);
+
+    GE::LogRateLimiter limiter{1};
+    EXPECT_TRUE(limiter.isAllowed());
+    EXPECT_FALSE(limiter.isAllowed());
+
+    GE::Log::shutdown();
+    std::filesystem::remove(log_file);
+}
+
+TEST(BoundedQueueTest, PushPop)
+{
+    GE::BoundedQueue<uint32_t> queue{3};
+    uint32_t value{0};
+
+    EXPECT_EQ(queue.getCapacity(), 4u);
+    EXPECT_FALSE(queue.tryPop(&value));
+
+    for (uint32_t i{0}; i < queue.getCapacity(); i++) {
+        EXPECT_TRUE(queue.tryPush(uint32_t{i}));
+    }
+
+    EXPECT_FALSE(queue.tryPush(42));
+
+    for (uint32_t i{0}; i < queue.getCapacity(); i++) {
+        ASSERT_TRUE(queue.tryPop(&value));
+        EXPECT_EQ(value, i);
+    }
+
+    EXPECT_TRUE(queue.isEmpty());
+}
+
+TEST(BoundedQueueTest, Threads)
+{
+    constexpr uint32_t threads_count{4};
+    constexpr uint64_t values_count{10000};
+    GE::BoundedQueue<uint64_t> queue{64};
+    std::vector<std::thread> producers;
+
+    for (uint32_t i{0}; i < threads_count; i++) {
+        producers.emplace_back([&queue] {
+            for (uint64_t value{1}; value <= values_count; value++) {
+                while (!queue.tryPush(uint64_t{value})) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    uint64_t sum{0};
+    uint64_t value{0};
+
+    for (uint64_t popped{0}; popped < threads_count * values_count;) {
+        if (queue.tryPop(&value)) {
+            sum += value;
+            popped++;
+        }
+    }
+
+    for (auto& producer : producers) {
+        producer.join();
+    }
+
+    EXPECT_EQ(sum, threads_count * values_count * (values_count + 1) / 2);
+}
+
 TEST_F(GECoreTest, Asserts)
 {
 #if !defined(GE_DISABLE_ASSERTS)
@@ -89,6 +357,288 @@ TEST_F(GECoreTest, Profiler)
     std::remove(profile_log);
 }
 
+TEST_F(GECoreTest, BinaryTrace)
+{
+    const char* json_file = "profile_test_converted.json";
+
+    EXPECT_FALSE(GE::Debug::convertTraceToJson("not_existing.getrace", json_file));
+
+#if defined(GE_PROFILING)
+    const char* trace_file = "profile_test.getrace";
+    constexpr uint32_t scope_count{100};
+
+    GE_PROFILE_ENABLE(true);
+    GE_PROFILE_BEGIN_SESSION("TraceTest", trace_file);
+
+    for (uint32_t i{0}; i < scope_count; i++) {
+        GE_PROFILE_SCOPE("TraceScope");
+    }
+
+    GE_GAUGE("TraceGauge", -42);
+    GE::Debug::Counters::mergeFrame();
+    GE_PROFILE_END_SESSION();
+    ASSERT_TRUE(GE::Debug::convertTraceToJson(trace_file, json_file));
+
+    std::ifstream json{json_file};
+    std::string content{std::istreambuf_iterator<char>{json}, {}};
+    std::string scope_name{R"("name":"TraceScope")"};
+    uint32_t found_count{0};
+
+    for (auto pos = content.find(scope_name); pos != std::string::npos;
+         pos = content.find(scope_name, pos + 1)) {
+        found_count++;
+    }
+
+    EXPECT_EQ(found_count, scope_count);
+    EXPECT_NE(content.find(R"("session":"TraceTest")"), std::string::npos);
+    EXPECT_NE(content.find(R"("name":"TraceGauge","ph":"C")"), std::string::npos);
+    EXPECT_NE(content.find(R"("args":{"value":-42})"), std::string::npos);
+
+    std::remove(trace_file);
+    std::remove(json_file);
+#endif
+}
+
+TEST_F(GECoreTest, FrameCapture)
+{
+#if defined(GE_PROFILING)
+    namespace fs = std::filesystem;
+
+    constexpr uint32_t frame_count{10};
+    constexpr uint32_t slow_frame{5};
+    fs::path capture_dir = fs::temp_directory_path() / "ge_frame_capture";
+    fs::create_directories(capture_dir);
+
+    GE_PROFILE_ENABLE(true);
+    GE_PROFILE_BEGIN_CAPTURE("CaptureTest", (capture_dir / "capture.getrace").string(), 3,
+                             0.015);
+
+    for (uint32_t i{0}; i < frame_count; i++) {
+        GE_PROFILE_FRAME_MARK();
+        GE_PROFILE_SCOPE("CaptureScope");
+        GE::sleep(i == slow_frame ? 0.03 : 0.0);
+    }
+
+    GE_PROFILE_FRAME_MARK();
+    GE_PROFILE_END_SESSION();
+
+    // Frames are counted from 1 and the first one ends on the second mark
+    EXPECT_TRUE(fs::exists(capture_dir / "capture_6.getrace"));
+    EXPECT_EQ(std::distance(fs::directory_iterator{capture_dir}, {}), 1);
+
+    fs::remove_all(capture_dir);
+#endif
+}
+
+TEST_F(GECoreTest, LiveFrames)
+{
+#if defined(GE_PROFILING)
+    constexpr uint32_t frame_count{5};
+    constexpr uint32_t live_frame_count{3};
+
+    GE_PROFILE_ENABLE(true);
+    GE::Debug::Profiler::setLiveFramesCount(live_frame_count);
+
+    for (uint32_t i{0}; i < frame_count; i++) {
+        GE_PROFILE_FRAME_MARK();
+        GE_PROFILE_SCOPE("LiveScope");
+    }
+
+    GE_PROFILE_FRAME_MARK();
+
+    size_t frames_size{0};
+    size_t events_size{0};
+    auto read_frames = [&frames_size, &events_size](const auto& frames) {
+        frames_size = frames.size();
+        events_size = frames.empty() ? 0 : frames.back().events.size();
+    };
+
+    // Frames are available once the collector has drained the rings
+    for (uint32_t i{0}; i < 100 && frames_size < live_frame_count; i++) {
+        GE::sleep(0.01);
+        GE::Debug::Profiler::readLiveFrames(read_frames);
+    }
+
+    GE::Debug::Profiler::setLiveFramesCount(0);
+
+    // The frame event itself and the scope
+    EXPECT_EQ(frames_size, live_frame_count);
+    EXPECT_EQ(events_size, 2u);
+#endif
+}
+
+TEST(CountersTest, FrameMerge)
+{
+    constexpr uint32_t thread_count{4};
+    constexpr int64_t thread_value{10};
+
+    auto find_counter = [](const char* name) {
+        const auto& values = GE::Debug::Counters::getFrameValues();
+        auto counter =
+            std::find_if(values.begin(), values.end(), [name](const auto& counter) {
+                return std::string_view{counter.name} == name;
+            });
+        return counter != values.end() ? *counter : GE::Debug::Counters::counter_t{};
+    };
+
+    std::vector<std::thread> threads;
+
+    for (uint32_t i{0}; i < thread_count; i++) {
+        threads.emplace_back([] {
+            for (int64_t j{0}; j < thread_value; j++) {
+                GE_COUNTER("TestCounter", 1);
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    GE_COUNTER("TestCounter", 2);
+    GE_GAUGE("TestGauge", 7);
+    GE::Debug::Counters::mergeFrame();
+
+    EXPECT_EQ(find_counter("TestCounter").value, thread_value * thread_count + 2);
+    EXPECT_EQ(find_counter("TestGauge").value, 7);
+
+    // Counters start from zero every frame, gauges keep the value
+    GE::Debug::Counters::mergeFrame();
+
+    EXPECT_EQ(find_counter("TestCounter").value, 0);
+    EXPECT_EQ(find_counter("TestCounter").total, thread_value * thread_count + 2);
+    EXPECT_EQ(find_counter("TestGauge").value, 7);
+}
+
+TEST(MemoryTest, TaggedAllocator)
+{
+    using GE::Debug::MemoryTag;
+    using Allocator = GE::Debug::TaggedAllocator<uint64_t, MemoryTag::RENDERER>;
+
+    constexpr size_t value_count{1024};
+    auto initial_stats = GE::Debug::Memory::getStats(MemoryTag::RENDERER);
+
+    {
+        std::vector<uint64_t, Allocator> values(value_count);
+        auto stats = GE::Debug::Memory::getStats(MemoryTag::RENDERER);
+
+        EXPECT_EQ(stats.bytes, initial_stats.bytes + value_count * sizeof(uint64_t));
+        EXPECT_EQ(stats.allocations, initial_stats.allocations + 1);
+
+        GE::Debug::Memory::mergeFrame();
+        EXPECT_GE(GE::Debug::Memory::getStats(MemoryTag::RENDERER).frame_allocations, 1u);
+    }
+
+    GE::Debug::Memory::mergeFrame();
+    auto stats = GE::Debug::Memory::getStats(MemoryTag::RENDERER);
+
+    EXPECT_EQ(stats.bytes, initial_stats.bytes);
+    EXPECT_EQ(stats.allocations, initial_stats.allocations);
+    EXPECT_EQ(stats.frame_allocations, 0u);
+}
+
+TEST(MemoryTest, GlobalHooks)
+{
+#if defined(GE_MEMORY_TRACKING)
+    using GE::Debug::MemoryTag;
+
+    auto initial_stats = GE::Debug::Memory::getStats(MemoryTag::ECS);
+    GE::Debug::Memory::mergeFrame();
+
+    {
+        GE_MEMORY_TAG(MemoryTag::ECS);
+        GE_MEMORY_HOT_PATH("MemoryTest");
+        auto value = GE::makeScoped<uint64_t>(0);
+
+        EXPECT_EQ(GE::Debug::Memory::getStats(MemoryTag::ECS).bytes,
+                  initial_stats.bytes + sizeof(uint64_t));
+    }
+
+    GE::Debug::Memory::mergeFrame();
+
+    EXPECT_EQ(GE::Debug::Memory::getStats(MemoryTag::ECS).bytes, initial_stats.bytes);
+    EXPECT_EQ(GE::Debug::Memory::getHotPathAllocations(), 1u);
+#endif
+}
+
+TEST(PoolTest, Handles)
+{
+    GE::Pool<std::string, 2> pool;
+
+    auto first = pool.create("first");
+    auto second = pool.create("second");
+    auto third = pool.create("third");
+    ASSERT_NE(pool.get(third), nullptr);
+    EXPECT_EQ(*pool.get(third), "third");
+    EXPECT_EQ(pool.getHandle(pool.get(second)), second);
+    EXPECT_EQ(pool.size(), 3u);
+
+    // The slot is reused, but the stale handle doesn't resolve
+    pool.destroy(first);
+    auto fourth = pool.create("fourth");
+    EXPECT_EQ(fourth.index, first.index);
+    EXPECT_EQ(pool.get(first), nullptr);
+    EXPECT_EQ(*pool.get(fourth), "fourth");
+    EXPECT_EQ(pool.get(GE::Handle<std::string>{}), nullptr);
+
+    pool.destroy(first);
+    EXPECT_EQ(pool.size(), 3u);
+}
+
+TEST(PoolTest, PoolAllocator)
+{
+    auto first = GE::makePooled<uint64_t>(1);
+    auto* first_ptr = first.get();
+    auto second = GE::makePooled<uint64_t>(2);
+    EXPECT_EQ(*first + *second, 3u);
+
+    // A freed block is reused first
+    first.reset();
+    auto third = GE::makePooled<uint64_t>(3);
+    EXPECT_EQ(third.get(), first_ptr);
+}
+
+TEST(FrameArenaTest, LinearArena)
+{
+    constexpr size_t block_size{256};
+    GE::LinearArena arena{block_size};
+
+    auto* first = arena.allocate(1, 1);
+    auto* aligned = arena.allocate(8, 64);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(aligned) % 64, 0u);
+    EXPECT_NE(first, aligned);
+
+    // Bigger than a block
+    arena.allocate(block_size * 2);
+    size_t capacity = arena.getCapacity();
+    EXPECT_GE(arena.getUsedSize(), block_size * 2);
+
+    arena.reset();
+    EXPECT_EQ(arena.getUsedSize(), 0u);
+    EXPECT_EQ(arena.allocate(1, 1), first);
+    EXPECT_EQ(arena.getCapacity(), capacity);
+}
+
+TEST(FrameArenaTest, DoubleBuffering)
+{
+    GE::FrameArena::nextFrame();
+    GE::FrameVector<uint32_t> values{1, 2, 3};
+    auto* arena = GE::FrameArena::get();
+    EXPECT_EQ(values.get_allocator().getArena(), arena);
+    EXPECT_GE(arena->getUsedSize(), sizeof(uint32_t) * 3);
+
+    // The data of the previous frame is still valid
+    GE::FrameArena::nextFrame();
+    auto* next_arena = GE::FrameArena::get();
+    next_arena->allocate(sizeof(uint32_t) * 3);
+    EXPECT_NE(next_arena, arena);
+    EXPECT_EQ(values, (GE::FrameVector<uint32_t>{1, 2, 3}));
+
+    GE::FrameArena::nextFrame();
+    EXPECT_EQ(GE::FrameArena::get(), arena);
+    EXPECT_LT(arena->getUsedSize(), sizeof(uint32_t) * 3);
+}
+
 TEST(TimestampTest, Conversion)
 {
     GE::Timestamp ts{0.123456789};
@@ -145,6 +695,81 @@ TEST(TimestampTest, FetchSub)
     EXPECT_DOUBLE_EQ(timestamp.ns(), 123456789.0);
 }
 
+TEST(FixedTimestepTest, Steps)
+{
+    GE::FixedTimestep disabled;
+    EXPECT_FALSE(disabled.isEnabled());
+    EXPECT_EQ(disabled.advance(1.0), 0u);
+    EXPECT_DOUBLE_EQ(disabled.getAlpha(), 1.0);
+
+    GE::FixedTimestep timestep{{0.01, 5}};
+    EXPECT_TRUE(timestep.isEnabled());
+
+    EXPECT_EQ(timestep.advance(0.025), 2u);
+    EXPECT_NEAR(timestep.getAlpha(), 0.5, 1e-9);
+
+    // The rest of the previous frame is carried over
+    EXPECT_EQ(timestep.advance(0.006), 1u);
+    EXPECT_NEAR(timestep.getAlpha(), 0.1, 1e-9);
+
+    EXPECT_EQ(timestep.advance(0.004), 0u);
+    EXPECT_NEAR(timestep.getAlpha(), 0.5, 1e-9);
+    EXPECT_EQ(timestep.getDroppedSteps(), 0u);
+}
+
+TEST(FixedTimestepTest, MaxSteps)
+{
+    GE::FixedTimestep timestep{{0.01, 4}};
+
+    // A heavy frame runs at most 'max_steps', the rest of whole steps is dropped
+    EXPECT_EQ(timestep.advance(0.1025), 4u);
+    EXPECT_EQ(timestep.getDroppedSteps(), 6u);
+    EXPECT_NEAR(timestep.getAlpha(), 0.25, 1e-6);
+
+    EXPECT_EQ(timestep.advance(0.008), 1u);
+    EXPECT_EQ(timestep.getDroppedSteps(), 6u);
+}
+
+TEST(FramePacerTest, Smoothing)
+{
+    GE::FramePacer pacer{{0.0, 0.0, 3}};
+    pacer.reset(0.0);
+
+    EXPECT_NEAR(pacer.beginFrame(0.01).sec(), 0.01, 1e-9);
+    EXPECT_NEAR(pacer.beginFrame(0.02).sec(), 0.01, 1e-9);
+    EXPECT_NEAR(pacer.beginFrame(0.06).sec(), 0.02, 1e-9);
+
+    // The oldest frame leaves the window
+    EXPECT_NEAR(pacer.beginFrame(0.07).sec(), 0.02, 1e-9);
+    EXPECT_EQ(pacer.getStats().frames_count, 4u);
+}
+
+TEST(FramePacerTest, Limit)
+{
+    constexpr uint32_t frame_count{5};
+    GE::FramePacer pacer{{200.0}};
+    GE::Timestamp begin = GE::Timestamp::now();
+    pacer.reset(begin);
+
+    for (uint32_t i{0}; i < frame_count; i++) {
+        pacer.beginFrame();
+        pacer.endFrame();
+    }
+
+    GE::Timestamp elapsed = GE::Timestamp::now() - begin;
+    const auto& stats = pacer.getStats();
+
+    EXPECT_TRUE(pacer.isLimited());
+    EXPECT_GE(elapsed.sec() + 1e-6, frame_count * pacer.getFramePeriod().sec());
+    EXPECT_EQ(stats.missed_deadlines, 0u);
+    EXPECT_GT(stats.sleep_time.sec(), 0.0);
+
+    // A frame longer than the period misses its deadline
+    std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    pacer.endFrame();
+    EXPECT_EQ(pacer.getStats().missed_deadlines, 1u);
+}
+
 class LayerMock: public GE::Layer
 {
 public:
@@ -279,4 +904,57 @@ TEST_F(LayerStackTest, ReplaceOverlayReverseOrder)
     }
 }
 
+class FrameCountingLayer: public GE::Layer
+{
+public:
+    void onAttach() override {}
+    void onDetach() override { detached = true; }
+    void onUpdate(GE::Timestamp delta_time) override
+    {
+        frames++;
+        time += delta_time;
+    }
+    void onEvent([[maybe_unused]] GE::Event* event) override {}
+
+    uint64_t frames{0};
+    GE::Timestamp time;
+    bool detached{false};
+};
+
+TEST(HeadlessApplicationTest, Run)
+{
+    ASSERT_TRUE(GE::Log::initialize());
+    ASSERT_TRUE(GE::Renderer::initialize(GE_HEADLESS_API));
+    ASSERT_TRUE(GE::Window::initialize());
+
+    // The application is reusable after the shutdown
+    for (int run = 0; run < 2; run++) {
+        GE::Window::properties_t window_props{};
+        window_props.width = 320;
+        window_props.height = 240;
+
+        ASSERT_TRUE(GE::Application::initializeHeadless(window_props, {0.01, 100}));
+        EXPECT_TRUE(GE::Application::isHeadless());
+        EXPECT_EQ(GE::Application::getWindow().getWidth(), 320u);
+        EXPECT_EQ(GE::Application::getWindow().getHeight(), 240u);
+
+        auto layer = GE::makeShared<FrameCountingLayer>();
+        GE::Application::pushLayer(layer);
+        GE::Application::run();
+
+        // Layers get the fixed frame time until the frame limit
+        EXPECT_EQ(layer->frames, 100u);
+        EXPECT_NEAR(layer->time.sec(), 1.0, 1e-9);
+
+        GE::Application::shutdown();
+        EXPECT_FALSE(GE::Application::isHeadless());
+        EXPECT_TRUE(layer->detached);
+        EXPECT_EQ(layer.use_count(), 1);
+    }
+
+    GE::Window::shutdown();
+    GE::Renderer::shutdown();
+    GE::Log::shutdown();
+}
+
 } // namespace
@@ -0,0 +1,333 @@
+#include "ge/core/log.h"
+#include "ge/renderer/buffers.h"
+#include "ge/renderer/framebuffer.h"
+#include "ge/renderer/gpu_timer.h"
+#include "ge/renderer/orthographic_camera.h"
+#include "ge/renderer/render_command.h"
+#include "ge/renderer/render_thread.h"
+#include "ge/renderer/renderer.h"
+#include "ge/renderer/renderer_2d.h"
+#include "ge/renderer/texture.h"
+#include "ge/renderer/vertex_array.h"
+#include "ge/window/window.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+namespace {
+
+namespace fs = std::filesystem;
+
+fs::path createAssetsDir()
+{
+    fs::path assets_dir = fs::temp_directory_path() / "ge_headless_assets";
+    fs::path shader_path = assets_dir / GE::Paths::TEXTURE_SHADER;
+    fs::create_directories(shader_path.parent_path());
+    std::ofstream{shader_path.string() + GE_VERT_EXT} << "void main() {}";
+    std::ofstream{shader_path.string() + GE_FRAG_EXT} << "void main() {}";
+    return assets_dir;
+}
+
+class HeadlessRendererTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        ASSERT_TRUE(GE::Log::initialize());
+        ASSERT_TRUE(GE::Renderer::initialize(GE_HEADLESS_API));
+    }
+
+    void TearDown() override
+    {
+        GE::Renderer::shutdown();
+        GE::Log::shutdown();
+    }
+
+    static GE::Shared<GE::VertexArray> createQuad()
+    {
+        constexpr std::array<float, 12> vertices{-0.5f, -0.5f, 0.0f, 0.5f, -0.5f, 0.0f,
+                                                 0.5f,  0.5f,  0.0f, -0.5f, 0.5f, 0.0f};
+        constexpr std::array<uint32_t, 6> indices{0, 1, 2, 2, 3, 0};
+
+        GE::Shared<GE::VertexBuffer> vbo =
+            GE::VertexBuffer::create(vertices.data(), sizeof(vertices));
+        vbo->setLayout({{GE_ELEMENT_FLOAT3, GE::Attributes::POS}});
+
+        GE::Shared<GE::VertexArray> vao = GE::VertexArray::create();
+        vao->addVertexBuffer(vbo);
+        vao->setIndexBuffer(GE::IndexBuffer::create(indices.data(), indices.size()));
+        return vao;
+    }
+};
+
+TEST_F(HeadlessRendererTest, API)
+{
+    EXPECT_EQ(GE::Renderer::getAPI(), GE_HEADLESS_API);
+    EXPECT_EQ(GE::toRendAPI(GE::toString(GE_HEADLESS_API)), GE_HEADLESS_API);
+    EXPECT_TRUE(GE::RendererAPI::isHeadless(GE_HEADLESS_API));
+    EXPECT_FALSE(GE::RendererAPI::isHeadless(GE_OPEN_GL_API));
+    EXPECT_GT(GE::Renderer::getCapabilities().max_texture_slots, 0u);
+}
+
+TEST_F(HeadlessRendererTest, DrawStatistics)
+{
+    auto vao = createQuad();
+    vao->bind();
+
+    GE::RenderCommand::clear({0.0f, 0.0f, 0.0f, 1.0f});
+    GE::RenderCommand::draw(vao);
+    GE::RenderCommand::draw(3);
+
+    const auto& stats = GE::RenderCommand::getStats();
+    EXPECT_EQ(stats.clear_count, 1u);
+    EXPECT_EQ(stats.draw_calls_count, 2u);
+    EXPECT_EQ(stats.index_count, 9u);
+
+    GE::RenderCommand::resetStats();
+    EXPECT_EQ(GE::RenderCommand::getStats().draw_calls_count, 0u);
+}
+
+TEST_F(HeadlessRendererTest, Textures)
+{
+    constexpr std::array<uint32_t, 4> pixels{0xFF0000FF, 0xFF00FF00, 0xFFFF0000,
+                                             0xFFFFFFFF};
+
+    auto texture = GE::Texture2D::create(2, 2, 4);
+    auto other_texture = GE::Texture2D::create(2, 2, 4);
+    texture->setData(pixels.data(), sizeof(pixels));
+
+    EXPECT_EQ(texture->getWidth(), 2u);
+    EXPECT_EQ(texture->getHeight(), 2u);
+    EXPECT_FALSE(*texture == *other_texture);
+}
+
+TEST_F(HeadlessRendererTest, Framebuffer)
+{
+    GE::Framebuffer::properties_t props{};
+    props.width = 4;
+    props.height = 4;
+
+    auto framebuffer = GE::Framebuffer::create(props);
+    framebuffer->resize({8.0f, 2.0f});
+
+    EXPECT_EQ(framebuffer->getProps().width, 8u);
+    EXPECT_EQ(framebuffer->getProps().height, 2u);
+}
+
+TEST_F(HeadlessRendererTest, GpuTimer)
+{
+    auto timer = GE::GpuTimer::create();
+    GE::GpuTimer::Samples samples;
+
+    ASSERT_TRUE(timer->begin("Outer"));
+    ASSERT_TRUE(timer->begin("Inner"));
+    timer->end();
+    timer->end();
+    timer->collect(&samples);
+
+    ASSERT_EQ(samples.size(), 2u);
+    EXPECT_STREQ(samples[0].name, "Inner");
+    EXPECT_STREQ(samples[1].name, "Outer");
+    EXPECT_LE(samples[1].start.sec(), samples[0].start.sec());
+    EXPECT_GE(samples[1].elapsed_time.sec(), samples[0].elapsed_time.sec());
+
+    samples.clear();
+    timer->collect(&samples);
+    EXPECT_TRUE(samples.empty());
+}
+
+TEST_F(HeadlessRendererTest, Renderer2D)
+{
+    constexpr uint32_t quad_count{10};
+    fs::path assets_dir = createAssetsDir();
+
+    ASSERT_TRUE(GE::Renderer2D::initialize(assets_dir.string()));
+    GE::Renderer2D::resetStats();
+    GE::RenderCommand::resetStats();
+
+    GE::Renderer2D::begin(GE::OrthographicCamera{-1.0f, 1.0f, -1.0f, 1.0f});
+
+    for (uint32_t i{0}; i < quad_count; i++) {
+        GE::Renderer2D::draw(GE::Renderer2D::quad_t{});
+    }
+
+    GE::Renderer2D::end();
+
+    EXPECT_EQ(GE::Renderer2D::getStats().quad_count, quad_count);
+    EXPECT_EQ(GE::Renderer2D::getStats().draw_calls_count, 1u);
+    EXPECT_EQ(GE::RenderCommand::getStats().draw_calls_count, 1u);
+    EXPECT_EQ(GE::RenderCommand::getStats().index_count, quad_count * 6);
+
+    GE::Renderer2D::shutdown();
+    fs::remove_all(assets_dir);
+}
+
+TEST_F(HeadlessRendererTest, RenderThread)
+{
+    constexpr uint32_t frame_count{3};
+    constexpr uint32_t sprite_count{10};
+    fs::path assets_dir = createAssetsDir();
+
+    ASSERT_TRUE(GE::Renderer2D::initialize(assets_dir.string()));
+    GE::Renderer2D::resetStats();
+    GE::RenderCommand::resetStats();
+
+    auto window = GE::Window::create({});
+    GE::RenderThread render_thread;
+    ASSERT_TRUE(render_thread.start(window.get()));
+    EXPECT_TRUE(render_thread.isRunning());
+    EXPECT_FALSE(GE::RenderThread::isContextThread());
+
+    // Tasks of the main thread are run by the render thread before the next frame
+    std::thread::id task_thread_id;
+    GE::RenderThread::runWithContext(
+        [&task_thread_id] { task_thread_id = std::this_thread::get_id(); });
+
+    for (uint32_t i{0}; i < frame_count; i++) {
+        GE::RenderSnapshot* snapshot = render_thread.getSnapshot();
+        EXPECT_TRUE(snapshot->isEmpty());
+
+        snapshot->setClearColor({0.0f, 0.0f, 0.0f, 1.0f});
+        snapshot->beginView(GE::OrthographicCamera{-1.0f, 1.0f, -1.0f, 1.0f});
+
+        for (uint32_t j{0}; j < sprite_count; j++) {
+            snapshot->addSprite(GE::RenderSnapshot::sprite_t{});
+        }
+
+        render_thread.submit();
+    }
+
+    render_thread.wait();
+    EXPECT_NE(task_thread_id, std::thread::id{});
+    EXPECT_NE(task_thread_id, std::this_thread::get_id());
+    EXPECT_EQ(GE::Renderer2D::getStats().quad_count, frame_count * sprite_count);
+    EXPECT_EQ(GE::RenderCommand::getStats().clear_count, frame_count);
+    EXPECT_EQ(GE::RenderCommand::getStats().draw_calls_count, frame_count);
+
+    // The stopped thread leaves the remaining tasks to the main thread
+    GE::RenderThread::runWithContext(
+        [&task_thread_id] { task_thread_id = std::this_thread::get_id(); });
+    render_thread.stop();
+    EXPECT_FALSE(render_thread.isRunning());
+    EXPECT_TRUE(GE::RenderThread::isContextThread());
+    EXPECT_EQ(task_thread_id, std::this_thread::get_id());
+
+    window.reset();
+    GE::Renderer2D::shutdown();
+    fs::remove_all(assets_dir);
+}
+
+class SoftwareRendererTest: public ::testing::Test
+{
+protected:
+    static constexpr uint32_t BLACK{0xFF000000};
+
+    void SetUp() override
+    {
+        ASSERT_TRUE(GE::Log::initialize());
+        ASSERT_TRUE(GE::Renderer::initialize(GE_SOFTWARE_API));
+
+        m_assets_dir = createAssetsDir();
+        ASSERT_TRUE(GE::Renderer2D::initialize(m_assets_dir.string()));
+    }
+
+    void TearDown() override
+    {
+        GE::Renderer2D::shutdown();
+        fs::remove_all(m_assets_dir);
+        GE::Renderer::shutdown();
+        GE::Log::shutdown();
+    }
+
+    static std::vector<uint32_t> render(uint32_t width, uint32_t height,
+                                        const std::vector<GE::Renderer2D::quad_t>& quads)
+    {
+        GE::Framebuffer::properties_t props{};
+        props.width = width;
+        props.height = height;
+
+        auto framebuffer = GE::Framebuffer::create(props);
+        framebuffer->bind();
+        GE::RenderCommand::clear({0.0f, 0.0f, 0.0f, 1.0f});
+        GE::Renderer2D::begin(GE::OrthographicCamera{-1.0f, 1.0f, -1.0f, 1.0f});
+
+        for (const auto& quad : quads) {
+            GE::Renderer2D::draw(quad);
+        }
+
+        GE::Renderer2D::end();
+        framebuffer->unbind();
+        return framebuffer->readColorAttachment();
+    }
+
+    fs::path m_assets_dir;
+};
+
+TEST_F(SoftwareRendererTest, API)
+{
+    EXPECT_EQ(GE::toRendAPI(GE::toString(GE_SOFTWARE_API)), GE_SOFTWARE_API);
+    EXPECT_TRUE(GE::RendererAPI::isHeadless(GE_SOFTWARE_API));
+}
+
+TEST_F(SoftwareRendererTest, Coverage)
+{
+    // Pixel centers lie on the diagonal shared by the two triangles of the quad,
+    // so double blending would produce a different color along it
+    GE::Renderer2D::quad_t quad{};
+    quad.color = {1.0f, 0.0f, 0.0f, 0.5f};
+
+    auto pixels = render(16, 16, {quad});
+
+    for (uint32_t y{0}; y < 16; y++) {
+        for (uint32_t x{0}; x < 16; x++) {
+            bool inside = x >= 4 && x < 12 && y >= 4 && y < 12;
+            EXPECT_EQ(pixels[y * 16 + x], inside ? 0xBF000080 : BLACK) << x << ", " << y;
+        }
+    }
+}
+
+TEST_F(SoftwareRendererTest, Texture)
+{
+    constexpr std::array<uint32_t, 4> texels{0xFF0000FF, 0xFF00FF00, 0xFFFF0000,
+                                             0xFFFFFFFF};
+    constexpr std::array<uint32_t, 16> expected{
+        0xFF0000FF, 0xFF0000FF, 0xFF00FF00, 0xFF00FF00, // Row 0
+        0xFF0000FF, 0xFF0000FF, 0xFF00FF00, 0xFF00FF00, // Row 1
+        0xFFFF0000, 0xFFFF0000, 0xFFFFFFFF, 0xFFFFFFFF, // Row 2
+        0xFFFF0000, 0xFFFF0000, 0xFFFFFFFF, 0xFFFFFFFF  // Row 3
+    };
+
+    GE::Shared<GE::Texture2D> texture = GE::Texture2D::create(2, 2, 4);
+    texture->setData(texels.data(), sizeof(texels));
+
+    GE::Renderer2D::quad_t quad{};
+    quad.size = {2.0f, 2.0f};
+    quad.texture = texture;
+
+    auto pixels = render(4, 4, {quad});
+    EXPECT_TRUE(std::equal(expected.begin(), expected.end(), pixels.begin()));
+}
+
+TEST_F(SoftwareRendererTest, DepthTest)
+{
+    GE::Renderer2D::quad_t near_quad{};
+    near_quad.size = {2.0f, 2.0f};
+    near_quad.color = {1.0f, 0.0f, 0.0f, 1.0f};
+    near_quad.depth = 0.5f;
+
+    GE::Renderer2D::quad_t far_quad{near_quad};
+    far_quad.color = {0.0f, 1.0f, 0.0f, 1.0f};
+    far_quad.depth = -0.5f;
+
+    auto pixels = render(8, 8, {near_quad, far_quad});
+    EXPECT_TRUE(std::all_of(pixels.begin(), pixels.end(),
+                            [](uint32_t pixel) { return pixel == 0xFF0000FF; }));
+}
+
+} // namespace
@@ -1,9 +1,19 @@
+#include "ge/renderer/renderer.h"
+#include "ge/window/event_channel.h"
+#include "ge/window/event_queue.h"
+#include "ge/window/input.h"
+#include "ge/window/input_recording.h"
+#include "ge/window/input_snapshot.h"
 #include "ge/window/key_event.h"
 #include "ge/window/mouse_event.h"
+#include "ge/window/user_event.h"
 #include "ge/window/window_event.h"
 
 #include "gtest/gtest.h"
 
+#include <filesystem>
+#include <thread>
+
 namespace GE {
 
 void PrintTo(GE::KeyCode key_code, std::ostream* os)
@@ -108,6 +118,12 @@ TEST(EventTest, Window)
     EXPECT_EQ(win_resized.getHeight(), win_resize_height);
 }
 
+template<typename EventType>
+bool handleEvent([[maybe_unused]] const EventType& event)
+{
+    return true;
+}
+
 template<typename EventType>
 class EventDispatcherTest: public ::testing::Test
 {};
@@ -120,7 +136,9 @@ using EventTypeList = ::testing::Types<
     GE::MouseButtonReleasedEvent,
     // Window events
     GE::WindowResizedEvent, GE::WindowClosedEvent, GE::WindowMaximizedEvent,
-    GE::WindowMinimizedEvent, GE::WindowRestoredEvent>;
+    GE::WindowMinimizedEvent, GE::WindowRestoredEvent,
+    // Application events
+    GE::UserEvent>;
 
 TYPED_TEST_SUITE(EventDispatcherTest, EventTypeList);
 
@@ -135,4 +153,315 @@ TYPED_TEST(EventDispatcherTest, SuccessfulDispatch)
     EXPECT_TRUE(event.handled());
 }
 
+TYPED_TEST(EventDispatcherTest, HandlerTable)
+{
+    TypeParam event{};
+    GE::EventHandlerTable<> handlers;
+
+    EXPECT_FALSE(handlers.has(TypeParam::getStaticType()));
+    EXPECT_FALSE(handlers.dispatch(&event));
+
+    handlers.add<TypeParam, handleEvent<TypeParam>>();
+
+    EXPECT_TRUE(handlers.has(TypeParam::getStaticType()));
+    EXPECT_TRUE(handlers.dispatch(&event));
+    EXPECT_TRUE(event.handled());
+}
+
+class EventHandlerOwner
+{
+public:
+    bool onKeyPressed(const GE::KeyPressedEvent& event)
+    {
+        m_key_code = event.getKeyCode();
+        return true;
+    }
+
+    bool onMouseMoved([[maybe_unused]] const GE::MouseMovedEvent& event)
+    {
+        m_mouse_moves++;
+        return false;
+    }
+
+    GE::KeyCode m_key_code{GE_KEY_UNKNOWN};
+    uint32_t m_mouse_moves{0};
+};
+
+TEST(EventHandlerTableTest, MemberHandlers)
+{
+    GE::EventHandlerTable<EventHandlerOwner> handlers;
+    handlers.add<GE::KeyPressedEvent, &EventHandlerOwner::onKeyPressed>();
+    handlers.add<GE::MouseMovedEvent, &EventHandlerOwner::onMouseMoved>();
+
+    EventHandlerOwner owner;
+    GE::KeyPressedEvent key_pressed{GE_KEY_A, 0};
+    GE::MouseMovedEvent mouse_moved{1.0f, 2.0f};
+    GE::WindowClosedEvent window_closed;
+
+    EXPECT_TRUE(handlers.dispatch(&key_pressed, &owner));
+    EXPECT_TRUE(key_pressed.handled());
+    EXPECT_EQ(owner.m_key_code, GE_KEY_A);
+
+    EXPECT_TRUE(handlers.dispatch(&mouse_moved, &owner));
+    EXPECT_TRUE(handlers.dispatch(&mouse_moved, &owner));
+    EXPECT_FALSE(mouse_moved.handled());
+    EXPECT_EQ(owner.m_mouse_moves, 2u);
+
+    EXPECT_FALSE(handlers.dispatch(&window_closed, &owner));
+    EXPECT_FALSE(window_closed.handled());
+}
+
+TEST(EventQueueTest, Coalescing)
+{
+    GE::EventQueue queue;
+    std::vector<GE::Event::Type> types;
+
+    queue.push(GE::MouseMovedEvent{1.0f, 1.0f});
+    queue.push(GE::MouseMovedEvent{2.0f, 3.0f});
+    queue.push(GE::MouseScrolledEvent{1.0f, 2.0f});
+    queue.push(GE::MouseScrolledEvent{3.0f, 4.0f});
+    queue.push(GE::KeyPressedEvent{GE_KEY_A});
+    queue.push(GE::KeyPressedEvent{GE_KEY_A});
+    queue.push(GE::WindowResizedEvent{320, 240});
+    queue.push(GE::WindowResizedEvent{640, 480});
+    queue.push(GE::MouseMovedEvent{4.0f, 5.0f});
+
+    EXPECT_EQ(queue.size(), 6u);
+    EXPECT_EQ(queue.getCoalescedEvents(), 3u);
+
+    queue.dispatch([&types](GE::Event* event) {
+        types.push_back(event->getType());
+
+        if (auto* moved = dynamic_cast<GE::MouseMovedEvent*>(event); moved != nullptr) {
+            EXPECT_EQ(moved->getPosX(), types.size() == 1 ? 2.0f : 4.0f);
+        } else if (auto* scrolled = dynamic_cast<GE::MouseScrolledEvent*>(event)) {
+            EXPECT_EQ(scrolled->getOffsetX(), 4.0f);
+            EXPECT_EQ(scrolled->getOffsetY(), 6.0f);
+        } else if (auto* resized = dynamic_cast<GE::WindowResizedEvent*>(event)) {
+            EXPECT_EQ(resized->getWidth(), 640u);
+            EXPECT_EQ(resized->getHeight(), 480u);
+        }
+    });
+
+    std::vector<GE::Event::Type> expected_types{
+        GE::Event::Type::MOUSE_MOVED,    GE::Event::Type::MOUSE_SCROLLED,
+        GE::Event::Type::KEY_PRESSED,    GE::Event::Type::KEY_PRESSED,
+        GE::Event::Type::WINDOW_RESIZED, GE::Event::Type::MOUSE_MOVED};
+
+    EXPECT_EQ(types, expected_types);
+    EXPECT_TRUE(queue.isEmpty());
+}
+
+TEST(EventQueueTest, KeyTypedText)
+{
+    GE::EventQueue queue;
+
+    {
+        std::string text{"typed"};
+        queue.push(GE::KeyTypedEvent{text.c_str()});
+        text = "overwritten";
+    }
+
+    queue.dispatch([](GE::Event* event) {
+        EXPECT_STREQ(static_cast<GE::KeyTypedEvent*>(event)->getText(), "typed");
+    });
+}
+
+TEST(EventQueueTest, PushOnDispatch)
+{
+    GE::EventQueue queue;
+    uint32_t dispatched{0};
+
+    queue.push(GE::WindowClosedEvent{});
+    queue.dispatch([&queue, &dispatched](GE::Event*) {
+        queue.push(GE::WindowRestoredEvent{});
+        dispatched++;
+    });
+
+    EXPECT_EQ(dispatched, 1u);
+    EXPECT_EQ(queue.size(), 1u);
+}
+
+TEST(EventChannelTest, PostAndDrain)
+{
+    GE::EventChannel channel{4};
+    std::vector<uint32_t> codes;
+
+    EXPECT_EQ(channel.getCapacity(), 4u);
+
+    for (uint32_t code{0}; code < 5; code++) {
+        EXPECT_EQ(channel.post<GE::UserEvent>(code), code < 4);
+    }
+
+    EXPECT_EQ(channel.getDroppedEvents(), 1u);
+
+    auto drained = channel.drain([&codes](GE::Event* event) {
+        ASSERT_EQ(event->getType(), GE::Event::Type::USER);
+        codes.push_back(static_cast<GE::UserEvent*>(event)->getCode());
+    });
+
+    EXPECT_EQ(drained, 4u);
+    EXPECT_EQ(codes, (std::vector<uint32_t>{0, 1, 2, 3}));
+
+    // Drained slots are reused
+    EXPECT_TRUE(channel.post<GE::WindowResizedEvent>(640u, 480u));
+    EXPECT_EQ(channel.drain([](GE::Event*) {}), 1u);
+}
+
+TEST(EventChannelTest, MultipleProducers)
+{
+    constexpr uint32_t producers_num{4};
+    constexpr uint32_t events_num{10000};
+
+    GE::EventChannel channel{64};
+    std::vector<std::thread> producers;
+    std::vector<uint32_t> received(producers_num, 0);
+    uint32_t total{0};
+
+    for (uint32_t producer{0}; producer < producers_num; producer++) {
+        producers.emplace_back([&channel, producer] {
+            for (uint32_t i{0}; i < events_num; i++) {
+                while (!channel.post<GE::UserEvent>(producer)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    while (total < producers_num * events_num) {
+        total += channel.drain([&received](GE::Event* event) {
+            received[static_cast<GE::UserEvent*>(event)->getCode()]++;
+        });
+    }
+
+    for (auto& producer : producers) {
+        producer.join();
+    }
+
+    EXPECT_EQ(received, std::vector<uint32_t>(producers_num, events_num));
+}
+
+TEST(InputSnapshotTest, KeyEdges)
+{
+    GE::InputSnapshot snapshot;
+
+    snapshot.setKeyPressed(GE_KEY_W, true);
+    EXPECT_TRUE(snapshot.isKeyPressed(GE_KEY_W));
+    EXPECT_TRUE(snapshot.isKeyJustPressed(GE_KEY_W));
+    EXPECT_FALSE(snapshot.isKeyJustReleased(GE_KEY_W));
+    EXPECT_FALSE(snapshot.isKeyPressed(GE_KEY_S));
+
+    snapshot.nextFrame();
+    snapshot.setKeyPressed(GE_KEY_W, true);
+    EXPECT_TRUE(snapshot.isKeyPressed(GE_KEY_W));
+    EXPECT_FALSE(snapshot.isKeyJustPressed(GE_KEY_W));
+
+    snapshot.nextFrame();
+    snapshot.setKeyPressed(GE_KEY_W, false);
+    EXPECT_FALSE(snapshot.isKeyPressed(GE_KEY_W));
+    EXPECT_TRUE(snapshot.isKeyJustReleased(GE_KEY_W));
+
+    // Codes out of range are never pressed
+    snapshot.setKeyPressed(static_cast<GE::KeyCode>(GE::KEY_CODES_COUNT), true);
+    EXPECT_FALSE(snapshot.isKeyPressed(static_cast<GE::KeyCode>(GE::KEY_CODES_COUNT)));
+}
+
+TEST(InputSnapshotTest, Mouse)
+{
+    GE::InputSnapshot snapshot;
+    glm::vec2 mouse_pos{10.0f, 20.0f};
+
+    snapshot.setMouseButtonPressed(GE_BUTTON_LEFT, true);
+    snapshot.setMousePos(mouse_pos);
+    EXPECT_TRUE(snapshot.isMouseButtonPressed(GE_BUTTON_LEFT));
+    EXPECT_TRUE(snapshot.isMouseButtonJustPressed(GE_BUTTON_LEFT));
+    EXPECT_FALSE(snapshot.isMouseButtonPressed(GE_BUTTON_RIGHT));
+    EXPECT_EQ(snapshot.getMousePos(), mouse_pos);
+
+    snapshot.nextFrame();
+    snapshot.setMouseButtonPressed(GE_BUTTON_LEFT, false);
+    EXPECT_TRUE(snapshot.isMouseButtonJustReleased(GE_BUTTON_LEFT));
+    EXPECT_FALSE(snapshot.isMouseButtonJustPressed(GE_BUTTON_LEFT));
+
+    snapshot.reset();
+    EXPECT_FALSE(snapshot.isMouseButtonJustReleased(GE_BUTTON_LEFT));
+}
+
+TEST(InputTest, KeyCodes)
+{
+    ASSERT_TRUE(GE::Renderer::initialize(GE_OPEN_GL_API));
+    ASSERT_TRUE(GE::Input::initialize());
+
+    // SDLK_RETURN is mapped to both RETURN and ENTER, the first mapping wins
+    constexpr int32_t sdl_return{'\r'};
+    EXPECT_EQ(GE::Input::toGEKeyCode(sdl_return), GE_KEY_RETURN);
+    EXPECT_EQ(GE::Input::toNativeKeyCode(GE_KEY_RETURN), sdl_return);
+    EXPECT_EQ(GE::Input::toNativeKeyCode(GE_KEY_ENTER), sdl_return);
+    EXPECT_EQ(GE::Input::toGEKeyCode('a'), GE_KEY_A);
+
+    GE::Input::shutdown();
+    GE::Renderer::shutdown();
+}
+
+TEST(InputRecordingTest, RecordAndReplay)
+{
+    auto filename = std::filesystem::temp_directory_path() / "ge_input_recording.bin";
+    GE::InputRecorder recorder;
+
+    ASSERT_TRUE(recorder.open(filename.string()));
+    recorder.beginFrame(0.016);
+    recorder.record(GE::KeyPressedEvent{GE_KEY_W, 2});
+    recorder.record(GE::KeyTypedEvent{"w"});
+    recorder.record(GE::MouseMovedEvent{10.0f, 20.0f});
+    recorder.beginFrame(0.032);
+    recorder.beginFrame(0.008);
+    recorder.record(GE::MouseButtonReleasedEvent{GE_BUTTON_RIGHT});
+    recorder.record(GE::WindowResizedEvent{640, 480});
+    recorder.record(GE::WindowClosedEvent{});
+    recorder.close();
+    EXPECT_TRUE(recorder.getFilename().empty());
+
+    GE::InputReplay replay;
+    std::vector<std::string> events;
+    std::vector<double> delta_times;
+    GE::Timestamp delta_time;
+
+    ASSERT_TRUE(replay.open(filename.string()));
+
+    while (replay.nextFrame(&delta_time)) {
+        delta_times.push_back(delta_time.sec());
+        replay.readEvents([&events](const GE::Event& event) {
+            events.push_back(event.toString());
+        });
+    }
+
+    std::vector<std::string> expected_events{
+        GE::KeyPressedEvent{GE_KEY_W, 2}.toString(),
+        GE::KeyTypedEvent{"w"}.toString(),
+        GE::MouseMovedEvent{10.0f, 20.0f}.toString(),
+        GE::MouseButtonReleasedEvent{GE_BUTTON_RIGHT}.toString(),
+        GE::WindowResizedEvent{640, 480}.toString(),
+        GE::WindowClosedEvent{}.toString()};
+
+    EXPECT_EQ(delta_times, (std::vector<double>{0.016, 0.032, 0.008}));
+    EXPECT_EQ(events, expected_events);
+
+    replay.close();
+    EXPECT_TRUE(replay.getFilename().empty());
+    std::filesystem::remove(filename);
+}
+
+TEST(InputRecordingTest, InvalidFile)
+{
+    auto filename = std::filesystem::temp_directory_path() / "ge_input_invalid.bin";
+    std::ofstream{filename} << "not a recording";
+
+    GE::InputReplay replay;
+    EXPECT_FALSE(replay.open(filename.string()));
+    EXPECT_FALSE(replay.isOpen());
+    EXPECT_FALSE(replay.open("/nonexistent/recording.bin"));
+
+    std::filesystem::remove(filename);
+}
+
 } // namespace
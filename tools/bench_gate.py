@@ -0,0 +1,204 @@
+#!/usr/bin/env python3
+"""Runs ge_benchmarks and compares the results to the stored baseline.
+
+A benchmark regresses if its median time exceeds the baseline by more than
+the relative threshold or by more than the noise of the runs, whichever is
+bigger. Per-frame counters (draw calls, allocations) are deterministic, so
+any noticeable growth of them is a regression too. Benchmarks which are new or
+missing in the baseline fail the gate as well, since nothing is checked for
+them. Baseline entries marked as pending are known benchmarks which haven't
+been measured on the reference machine yet, they are only reported.
+"""
+
+import argparse
+import json
+import subprocess
+import sys
+import tempfile
+
+TIME_COUNTERS = ("frame_p50_us", "frame_p95_us", "frame_p99_us")
+COUNT_COUNTERS = ("draw_calls", "allocations")
+COUNT_TOLERANCE = 0.01
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--benchmarks", required=True, help="ge_benchmarks binary")
+    parser.add_argument("--baseline", required=True, help="baseline JSON file")
+    parser.add_argument("--update", action="store_true",
+                        help="write the results to the baseline instead of comparing, "
+                             "merges them into the baseline if --filter is set")
+    parser.add_argument("--allow-new", action="store_true",
+                        help="don't fail on benchmarks which are new or missing in "
+                             "the baseline")
+    parser.add_argument("--filter", default="", help="benchmark filter regex")
+    parser.add_argument("--repetitions", type=int, default=5)
+    parser.add_argument("--min-time", default="0.2",
+                        help="minimal time of a repetition, seconds")
+    parser.add_argument("--threshold", type=float, default=0.10,
+                        help="allowed relative slowdown")
+    parser.add_argument("--noise-factor", type=float, default=3.0,
+                        help="allowed slowdown in coefficients of variation")
+    return parser.parse_args()
+
+
+def run_benchmarks(args):
+    with tempfile.NamedTemporaryFile(suffix=".json") as out:
+        cmd = [args.benchmarks,
+               "--benchmark_out=" + out.name,
+               "--benchmark_out_format=json",
+               "--benchmark_repetitions={}".format(args.repetitions),
+               "--benchmark_report_aggregates_only=true",
+               "--benchmark_min_time={}".format(args.min_time)]
+
+        if args.filter:
+            cmd.append("--benchmark_filter=" + args.filter)
+
+        subprocess.run(cmd, check=True)
+
+        with open(out.name) as report:
+            return json.load(report)
+
+
+def collect_results(report):
+    results = {}
+    known_keys = {"name", "run_name", "run_type", "aggregate_name", "aggregate_unit",
+                  "repetitions", "threads", "iterations", "real_time", "cpu_time",
+                  "time_unit", "family_index", "per_family_instance_index",
+                  "repetition_index", "error_occurred", "error_message"}
+
+    for bench in report["benchmarks"]:
+        if bench.get("error_occurred"):
+            continue
+
+        result = results.setdefault(bench["run_name"], {"time_unit": bench["time_unit"]})
+        aggregate = bench.get("aggregate_name", "median")
+
+        if aggregate == "median":
+            result["real_time"] = bench["real_time"]
+            result.update({key: value for key, value in bench.items()
+                           if key not in known_keys and isinstance(value, (int, float))})
+        elif aggregate == "cv":
+            result["cv"] = bench["real_time"]
+
+    return results
+
+
+def compare(base, curr, args):
+    cv = max(base.get("cv", 0.0), curr.get("cv", 0.0))
+    allowed = max(args.threshold, args.noise_factor * cv)
+    change = curr["real_time"] / base["real_time"] - 1.0
+    failures = []
+
+    if change > allowed:
+        failures.append("time +{:.1%} > {:.1%}".format(change, allowed))
+
+    for counter in COUNT_COUNTERS:
+        if counter in base and counter in curr:
+            limit = base[counter] * (1.0 + COUNT_TOLERANCE) + 0.5
+
+            if curr[counter] > limit:
+                failures.append("{} {:.1f} > {:.1f}".format(counter, curr[counter],
+                                                            base[counter]))
+
+    return change, allowed, failures
+
+
+def format_counters(result):
+    columns = []
+
+    for counter in TIME_COUNTERS + COUNT_COUNTERS:
+        if counter in result:
+            columns.append("{}={:.1f}".format(counter, result[counter]))
+
+    return " ".join(columns)
+
+
+def print_report(baseline, results, args):
+    regressions = 0
+    unknown = 0
+    pending = 0
+
+    print("\n{:<48} {:>12} {:>12} {:>8} {:>8}  {}".format(
+        "Benchmark", "Baseline", "Current", "Change", "Allowed", "Status"))
+
+    for name, curr in sorted(results.items()):
+        base = baseline.get(name)
+        unit = curr["time_unit"]
+
+        if base is None:
+            unknown += 1
+            print("{:<48} {:>12} {:>9.1f} {:<2} {:>8} {:>8}  NEW".format(
+                name, "-", curr["real_time"], unit, "-", "-"))
+        elif base.get("pending"):
+            pending += 1
+            print("{:<48} {:>12} {:>9.1f} {:<2} {:>8} {:>8}  PENDING".format(
+                name, "-", curr["real_time"], unit, "-", "-"))
+        else:
+            change, allowed, failures = compare(base, curr, args)
+            status = "FAIL: " + ", ".join(failures) if failures else "OK"
+            regressions += 1 if failures else 0
+            print("{:<48} {:>9.1f} {:<2} {:>9.1f} {:<2} {:>+7.1%} {:>7.1%}  {}".format(
+                name, base["real_time"], base["time_unit"], curr["real_time"], unit,
+                change, allowed, status))
+
+        counters = format_counters(curr)
+
+        if counters:
+            print("    " + counters)
+
+    for name in sorted(set(baseline) - set(results)):
+        if not args.filter:
+            unknown += 1
+            print("{:<48} MISSING".format(name))
+
+    return regressions, unknown, pending
+
+
+def update_baseline(results, args):
+    baseline = {}
+
+    if args.filter:
+        with open(args.baseline) as baseline_file:
+            baseline = json.load(baseline_file)
+
+    baseline.update(results)
+
+    with open(args.baseline, "w") as baseline_file:
+        json.dump(baseline, baseline_file, indent=4, sort_keys=True)
+        baseline_file.write("\n")
+
+
+def main():
+    args = parse_args()
+    results = collect_results(run_benchmarks(args))
+
+    if args.update:
+        update_baseline(results, args)
+        print("Baseline has been written to '{}'".format(args.baseline))
+        return 0
+
+    with open(args.baseline) as baseline_file:
+        baseline = json.load(baseline_file)
+
+    regressions, unknown, pending = print_report(baseline, results, args)
+
+    if regressions > 0:
+        print("\n{} benchmark(s) regressed".format(regressions))
+        return 1
+
+    if unknown > 0 and not args.allow_new:
+        print("\n{} benchmark(s) are new or missing, update the baseline or pass "
+              "--allow-new".format(unknown))
+        return 1
+
+    if pending > 0:
+        print("\n{} benchmark(s) have no measured baseline yet, update it on the "
+              "reference machine".format(pending))
+
+    print("\nNo regressions")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())